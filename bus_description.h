@@ -5,6 +5,8 @@ struct BusDescription {
   char number[3];
   char time[5];
   char mins[2];
+  // ExpectedDateTime in datetimeSeconds() terms
+  long expected;
   int journey_number;
   int stop_id;
 };
@@ -0,0 +1,251 @@
+#include <Arduino.h>
+#include <FlashStorage.h>
+#include <stddef.h>
+
+#include "departure_cache.h"
+#include "departure_merge.h"
+#include "departure_parser.h"
+#include "retry_policy.h"
+#include "stops.h"
+#include "wall_clock.h"
+#include "logging.h"
+
+// fetched_at for departures stored while the clock wasn't set. They can be
+// shown, with the minutes blank, but not counted down from.
+const long kUndated = -1;
+
+// The cache as it is kept in RAM and written to flash.
+struct CacheRecord {
+  // Counts up with every flash write, to find the newest slot.
+  uint32_t seq;
+  // When each stop was last fetched, 0 if it never has been, or kUndated.
+  long fetched_at[kStops];
+  int count[kStops];
+  BusDescription descs[kStops][kMaxStopDepartures];
+  // FNV-1a over everything above.
+  uint32_t checksum;
+};
+
+// Flash rows are erased 256 bytes at a time and wear out after some tens of
+// thousands of erases, so records rotate round a few slots.
+const int kFlashSlots = 4;
+const int kFlashSlotSize = (sizeof(CacheRecord) + 255) / 256 * 256;
+__attribute__((__aligned__(256))) static const uint8_t cache_flash_data[kFlashSlots * kFlashSlotSize] = { };
+FlashClass cache_flash(cache_flash_data, sizeof(cache_flash_data));
+
+// Kept in RAM, which LowPower.deepSleep() (standby on the SAMD21) preserves,
+// so the cache carries over from one wake to the next. Flash only matters
+// after a reset.
+static CacheRecord cache;
+static bool have_cache = false;
+// Departures the cache had to show when it was fetched.
+static int fetched_upcoming;
+// Where the last record went, and when.
+static int flash_slot = -1;
+static long flashed_at;
+// Stops whose last query failed in a way that asking again won't fix, such
+// as an unknown stop id. Until one works again it's left out when deciding
+// whether the cache will do, so it doesn't force a fetch every wake.
+static bool stop_failing[kStops];
+
+static uint32_t checksum(const CacheRecord* record) {
+  const uint8_t* bytes = (const uint8_t*)record;
+  uint32_t hash = 2166136261u;
+  for (unsigned i = 0; i < offsetof(CacheRecord, checksum); i++) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+static const volatile void* slotAddress(int slot) {
+  return cache_flash_data + slot * kFlashSlotSize;
+}
+
+// Fills combined_descs with the departures still catchable at now and
+// returns how many. With now 0, the time isn't known, so everything is kept
+// and the minutes are left blank.
+static int combine(long now, BusDescription* combined_descs) {
+  const BusDescription* lists[kStops];
+  for (int stop = 0; stop < kStops; stop++) {
+    lists[stop] = cache.descs[stop];
+  }
+  return mergeDepartures(lists, cache.count, now, combined_descs);
+}
+
+// mergeDepartures() needs each stop's departures in time order. The API
+// sends them that way, so this is one pass unless it ever doesn't.
+static void sortByExpected(BusDescription* descs, int count) {
+  for (int i = 1; i < count; i++) {
+    BusDescription desc = descs[i];
+    int j = i;
+    for (; j > 0 && descs[j - 1].expected > desc.expected; j--) {
+      descs[j] = descs[j - 1];
+    }
+    descs[j] = desc;
+  }
+}
+
+// When the oldest dated data in the cache was fetched, 0 if there is none.
+// Stops that keep failing are left out if skip_failing.
+static long oldestFetch(bool skip_failing) {
+  long oldest = 0;
+  for (int stop = 0; stop < kStops; stop++) {
+    if (skip_failing && stop_failing[stop]) {
+      continue;
+    }
+    if (cache.fetched_at[stop] > 0 && (oldest == 0 || cache.fetched_at[stop] < oldest)) {
+      oldest = cache.fetched_at[stop];
+    }
+  }
+  return oldest;
+}
+
+// Whether every stop that can be fetched has dated departures, and at least
+// one does.
+static bool allFetched() {
+  int fetched = 0;
+  for (int stop = 0; stop < kStops; stop++) {
+    if (stop_failing[stop]) {
+      continue;
+    }
+    if (cache.fetched_at[stop] <= 0) {
+      return false;
+    }
+    fetched++;
+  }
+  return fetched > 0;
+}
+
+// Writes the cache to the next flash slot. The departures barely change
+// between some fetches, so an unchanged set isn't written again until
+// kFlashMinIntervalSecs have passed.
+static void persist(bool changed) {
+  long now = wallClockNow();
+  if (!changed && flash_slot >= 0 && now - flashed_at < kFlashMinIntervalSecs) {
+    DEBUG_PRINTLN("Departures unchanged, not written to flash");
+    return;
+  }
+  flash_slot = (flash_slot + 1) % kFlashSlots;
+  cache.seq++;
+  cache.checksum = checksum(&cache);
+  cache_flash.erase(slotAddress(flash_slot), kFlashSlotSize);
+  cache_flash.write(slotAddress(flash_slot), &cache, sizeof(CacheRecord));
+  flashed_at = now;
+  DEBUG_PRINT("Departures written to flash slot ");
+  DEBUG_PRINTLN(flash_slot);
+}
+
+bool departureCacheLoad() {
+  CacheRecord record;
+  bool found = false;
+  for (int slot = 0; slot < kFlashSlots; slot++) {
+    cache_flash.read(slotAddress(slot), &record, sizeof(CacheRecord));
+    if (record.checksum != checksum(&record)) {
+      continue;
+    }
+    if (!found || record.seq > cache.seq) {
+      cache = record;
+      flash_slot = slot;
+      found = true;
+    }
+  }
+  if (!found) {
+    return false;
+  }
+  have_cache = true;
+  // The clock restarted with the reset, so nothing can be counted from the
+  // record until the next fetch sets it.
+  flashed_at = 0;
+  fetched_upcoming = 0;
+  Serial.print("Loaded departures from flash, record ");
+  Serial.println(cache.seq);
+  return true;
+}
+
+void departureCacheStore(BusResults* results, long now) {
+  if (now != 0) {
+    wallClockSet(now);
+  }
+  // If no stop gave a time, the departures are still worth showing, but
+  // there's nothing to count their minutes from.
+  long fetched_at = wallClockValid() ? wallClockNow() : kUndated;
+  bool changed = false;
+  for (int stop = 0; stop < kStops; stop++) {
+    if (results[stop].result != 0) {
+      // Keep what we had for this stop.
+      stop_failing[stop] = !isTransientError(results[stop].result);
+      continue;
+    }
+    stop_failing[stop] = false;
+    sortByExpected(results[stop].descs, results[stop].len);
+    int bytes = sizeof(BusDescription) * results[stop].len;
+    changed |= cache.count[stop] != results[stop].len ||
+               (bytes > 0 && memcmp(cache.descs[stop], results[stop].descs, bytes) != 0);
+    cache.count[stop] = results[stop].len;
+    if (bytes > 0) {
+      memcpy(cache.descs[stop], results[stop].descs, bytes);
+    }
+    cache.fetched_at[stop] = fetched_at;
+  }
+  have_cache = true;
+
+  BusDescription combined_descs[kMaxMergedDepartures];
+  fetched_upcoming = combine(fetched_at > 0 ? fetched_at : 0, combined_descs);
+  persist(changed);
+}
+
+bool departureCacheUsable() {
+  if (!have_cache || !wallClockValid()) {
+    return false;
+  }
+  if (!allFetched()) {
+    DEBUG_PRINTLN("Cache is missing stops");
+    return false;
+  }
+  long now = wallClockNow();
+  long age = now - oldestFetch(true);
+  if (age > kCacheMaxAgeSecs) {
+    DEBUG_PRINT("Cache is stale, fetched seconds ago: ");
+    DEBUG_PRINTLN(age);
+    return false;
+  }
+  BusDescription combined_descs[kMaxMergedDepartures];
+  int upcoming = combine(now, combined_descs);
+  // A quiet window can't give more than it had, so only fetch for more once
+  // some of what it did have has gone.
+  if (upcoming < kCacheMinUpcoming && upcoming < fetched_upcoming) {
+    DEBUG_PRINT("Cache is running short, departures left: ");
+    DEBUG_PRINTLN(upcoming);
+    return false;
+  }
+  return true;
+}
+
+bool departureCacheFetchedTime(char* time) {
+  long fetched_at = oldestFetch(false);
+  if (fetched_at == 0) {
+    return false;
+  }
+  int hours = (fetched_at / 3600) % 24;
+  int mins = (fetched_at / 60) % 60;
+  time[0] = hours / 10 + '0';
+  time[1] = hours % 10 + '0';
+  time[2] = ':';
+  time[3] = mins / 10 + '0';
+  time[4] = mins % 10 + '0';
+  return true;
+}
+
+BusResults cachedDepartures() {
+  BusDescription* combined_descs = (BusDescription*)(malloc(sizeof(BusDescription) * kMaxMergedDepartures));
+  if (combined_descs == NULL) {
+    return BusResults{result: -6};
+  }
+  int unique_result_count = 0;
+  if (have_cache) {
+    unique_result_count = combine(wallClockValid() ? wallClockNow() : 0, combined_descs);
+  }
+  DEBUG_PRINT("Combined to give a result count of : ");
+  DEBUG_PRINTLN(unique_result_count);
+  return BusResults{result: 0, descs: combined_descs, len: unique_result_count};
+}
@@ -0,0 +1,40 @@
+#ifndef departure_cache_h
+#define departure_cache_h
+
+#include "bus_description.h"
+
+// Fetched departures are trusted for this long before fetching again, as
+// delays change.
+const long kCacheMaxAgeSecs = 30 * 60;
+// Fetch again once fewer than this many departures are still to come.
+const int kCacheMinUpcoming = 4;
+// An unchanged set of departures isn't written to flash again until this
+// long after the last write.
+const long kFlashMinIntervalSecs = 2 * 60 * 60;
+
+// Reads the last departures written to flash, after a reset. Returns whether
+// there were any.
+bool departureCacheLoad();
+
+// Updates the cache with the departures just fetched, one BusResults per
+// stop in kStopTable order. Stops that failed keep what they had before. now is
+// the time the API gave with them, 0 if none; without it or a set clock the
+// departures are kept undated. The result is also written to flash.
+void departureCacheStore(BusResults* results, long now);
+
+// Whether the cache is fresh enough, and has enough departures left, to
+// show without fetching. Stops whose last query failed with a permanent
+// error are left out until one works.
+bool departureCacheUsable();
+
+// The cached departures still catchable at wallClockNow(), with their minutes
+// counted from then, one line per bus and soonest first. If the clock isn't
+// set, as after a reset, they are all given with the minutes blank. descs is
+// malloced.
+BusResults cachedDepartures();
+
+// Writes the time, as HH:MM, of the oldest data in the cache. Returns false
+// if there is none.
+bool departureCacheFetchedTime(char* time);
+
+#endif
@@ -0,0 +1,118 @@
+#include <Arduino.h>
+
+#include "departure_merge.h"
+
+// Journeys already merged are kept in an open addressing hash set, sized to
+// a power of two at least half as big again as the most it can hold so the
+// probe runs stay short.
+constexpr int bitsFor(int n) {
+  return n <= 1 ? 0 : 1 + bitsFor((n + 1) / 2);
+}
+const int kJourneySlotBits = bitsFor(kMaxMergedDepartures * 3 / 2);
+const int kJourneySlots = 1 << kJourneySlotBits;
+const int32_t kEmptySlot = INT32_MIN;
+
+// Adds journey to the set. Returns false if it was already there.
+static bool addJourney(int32_t* slots, int32_t journey) {
+  // Fibonacci hashing: the top bits of the product mix in every bit of the
+  // journey number.
+  uint32_t slot = ((uint32_t)journey * 2654435769u) >> (32 - kJourneySlotBits);
+  while (slots[slot] != kEmptySlot) {
+    if (slots[slot] == journey) {
+      return false;
+    }
+    slot = (slot + 1) & (kJourneySlots - 1);
+  }
+  slots[slot] = journey;
+  return true;
+}
+
+// A min-heap of stops, ordered by each one's next departure. Ties go to the
+// stop listed first, as its departure is the one kept.
+struct StopHeap {
+  const BusDescription* const* lists;
+  int next[kStops];
+  int stops[kStops];
+  int len;
+};
+
+static bool sooner(const StopHeap* heap, int a, int b) {
+  long expected_a = heap->lists[a][heap->next[a]].expected;
+  long expected_b = heap->lists[b][heap->next[b]].expected;
+  return expected_a < expected_b || (expected_a == expected_b && a < b);
+}
+
+static void siftDown(StopHeap* heap, int i) {
+  for (;;) {
+    int smallest = i;
+    int left = 2 * i + 1;
+    int right = left + 1;
+    if (left < heap->len && sooner(heap, heap->stops[left], heap->stops[smallest])) {
+      smallest = left;
+    }
+    if (right < heap->len && sooner(heap, heap->stops[right], heap->stops[smallest])) {
+      smallest = right;
+    }
+    if (smallest == i) {
+      return;
+    }
+    int stop = heap->stops[i];
+    heap->stops[i] = heap->stops[smallest];
+    heap->stops[smallest] = stop;
+    i = smallest;
+  }
+}
+
+int mergeDepartures(const BusDescription* const* lists, const int* counts, long now, BusDescription* out) {
+  StopHeap heap;
+  heap.lists = lists;
+  heap.len = 0;
+  for (int stop = 0; stop < kStops; stop++) {
+    int next = 0;
+    if (now != 0) {
+      // In time order, so the ones too soon to catch are all at the start.
+      while (next < counts[stop] && (lists[stop][next].expected - now) / 60 < kStopTable[stop].minimum_mins) {
+        next++;
+      }
+    }
+    heap.next[stop] = next;
+    if (next < counts[stop]) {
+      heap.stops[heap.len++] = stop;
+    }
+  }
+  for (int i = heap.len / 2 - 1; i >= 0; i--) {
+    siftDown(&heap, i);
+  }
+
+  int32_t journeys[kJourneySlots];
+  for (int i = 0; i < kJourneySlots; i++) {
+    journeys[i] = kEmptySlot;
+  }
+
+  // Departures come out soonest first, so the first time a journey turns up
+  // is at the stop it reaches first.
+  int count = 0;
+  while (heap.len > 0) {
+    int stop = heap.stops[0];
+    const BusDescription* desc = &lists[stop][heap.next[stop]++];
+    if (heap.next[stop] == counts[stop]) {
+      heap.stops[0] = heap.stops[--heap.len];
+    }
+    siftDown(&heap, 0);
+
+    if (!addJourney(journeys, desc->journey_number)) {
+      continue;
+    }
+    BusDescription* merged = &out[count++];
+    *merged = *desc;
+    if (now == 0) {
+      merged->mins[0] = ' ';
+      merged->mins[1] = ' ';
+    } else {
+      int mins = (desc->expected - now) / 60;
+      merged->mins[0] = ((mins / 10) % 10) + '0';
+      merged->mins[1] = (mins % 10) + '0';
+    }
+  }
+  return count;
+}
@@ -0,0 +1,20 @@
+#ifndef departure_merge_h
+#define departure_merge_h
+
+#include "bus_description.h"
+#include "departure_parser.h"
+#include "stops.h"
+
+// Most departures mergeDepartures() can give back.
+const int kMaxMergedDepartures = kStops * kMaxStopDepartures;
+
+// Merges every stop's departures into out, soonest first. lists[stop] holds
+// counts[stop] departures from kStopTable[stop], in time order. Departures
+// less than their stop's minimum away at now are left out, and a bus calling
+// at several of our stops is kept only where it calls first. With now 0 the
+// time isn't known, so nothing is left out for being too soon and the
+// minutes are blank. out needs room for kMaxMergedDepartures. Returns how
+// many departures it holds.
+int mergeDepartures(const BusDescription* const* lists, const int* counts, long now, BusDescription* out);
+
+#endif
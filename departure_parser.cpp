@@ -0,0 +1,246 @@
+#include <Arduino.h>
+
+#include "departure_parser.h"
+#include "wall_clock.h"
+
+// What an open object or array is, as far as we care, plus kObject for
+// objects so we know whether a string after a comma is a key.
+enum {
+  kOther,
+  kRoot,
+  kResponseData,
+  kBuses,
+  kBus,
+  kObject = 0x80,
+};
+
+void departureParserBegin(DepartureParser* parser, int stop_id, int minimum_mins, BusDescription* descs) {
+  memset(parser, 0, sizeof(DepartureParser));
+  parser->stop_id = stop_id;
+  parser->minimum_mins = minimum_mins;
+  parser->descs = descs;
+  parser->status_code = -1;
+}
+
+static bool keyIs(DepartureParser* parser, const char* name) {
+  return strcmp(parser->key, name) == 0;
+}
+
+static int currentContext(DepartureParser* parser) {
+  if (parser->depth == 0 || parser->depth > kParserMaxDepth) {
+    return kOther;
+  }
+  return parser->context[parser->depth - 1] & ~kObject;
+}
+
+static bool inObject(DepartureParser* parser) {
+  if (parser->depth == 0 || parser->depth > kParserMaxDepth) {
+    return false;
+  }
+  return parser->context[parser->depth - 1] & kObject;
+}
+
+static void startBus(DepartureParser* parser) {
+  parser->line_number[0] = '\0';
+  parser->expected_time[0] = '\0';
+  parser->journey_number = 0;
+  parser->journey_direction = 0;
+}
+
+static void endBus(DepartureParser* parser) {
+  if (parser->journey_direction != 2) {
+    return; // Probably means it's not going into town.
+  }
+  if (!parser->have_latest_update || !parser->have_data_age || strlen(parser->expected_time) < 19) {
+    parser->failed = true;
+    return;
+  }
+
+  long expected = datetimeSeconds(parser->expected_time);
+  int mins = (expected - parser->now) / 60;
+  if (mins < parser->minimum_mins) {
+    return;
+  }
+
+  BusDescription* desc = &parser->descs[parser->count++];
+  memcpy(desc->number, parser->line_number, 3);
+  memcpy(desc->time, parser->expected_time + 11, 5);
+  desc->expected = expected;
+  desc->journey_number = parser->journey_number;
+  desc->stop_id = parser->stop_id;
+  desc->mins[0] = ((mins / 10) % 10) + '0';
+  desc->mins[1] = (mins % 10) + '0';
+
+  // Departures come in time order, so the first few that pass are the ones
+  // we'd show.
+  if (parser->count == kMaxStopDepartures) {
+    parser->done = true;
+  }
+}
+
+// Handles a complete string or scalar value. Strings are NUL terminated in
+// parser->text, truncated to fit.
+static void value(DepartureParser* parser, bool is_string) {
+  int context = currentContext(parser);
+  const char* text = parser->text;
+  if (context == kRoot && keyIs(parser, "StatusCode")) {
+    parser->status_code = atoi(text);
+    if (parser->status_code != 0) {
+      parser->done = true;
+    }
+  } else if (context == kResponseData) {
+    if (keyIs(parser, "LatestUpdate") && is_string) {
+      strcpy(parser->latest_update, text);
+      parser->have_latest_update = strlen(text) >= 19;
+    } else if (keyIs(parser, "DataAge") && !is_string) {
+      parser->data_age = atoi(text);
+      parser->have_data_age = true;
+    }
+    if (parser->have_latest_update && parser->have_data_age) {
+      parser->now = datetimeSeconds(parser->latest_update) + parser->data_age;
+    }
+  } else if (context == kBus) {
+    if (keyIs(parser, "LineNumber") && is_string) {
+      strcpy(parser->line_number, text);
+    } else if (keyIs(parser, "ExpectedDateTime") && is_string) {
+      strcpy(parser->expected_time, text);
+    } else if (keyIs(parser, "JourneyNumber") && !is_string) {
+      parser->journey_number = atoi(text);
+    } else if (keyIs(parser, "JourneyDirection") && !is_string) {
+      parser->journey_direction = atoi(text);
+    }
+  }
+}
+
+static void openContainer(DepartureParser* parser, bool is_object) {
+  int parent = currentContext(parser);
+  int context = kOther;
+  if (is_object) {
+    if (parser->depth == 0) {
+      context = kRoot;
+    } else if (parent == kRoot && keyIs(parser, "ResponseData")) {
+      context = kResponseData;
+    } else if (parent == kBuses) {
+      context = kBus;
+      startBus(parser);
+    }
+  } else if (parent == kResponseData && keyIs(parser, "Buses")) {
+    context = kBuses;
+  }
+  if (parser->depth < kParserMaxDepth) {
+    parser->context[parser->depth] = context | (is_object ? kObject : 0);
+  }
+  parser->depth++;
+  parser->expecting_key = is_object;
+}
+
+static void closeContainer(DepartureParser* parser) {
+  if (parser->depth == 0) {
+    parser->failed = true;
+    return;
+  }
+  int context = currentContext(parser);
+  parser->depth--;
+  if (context == kBus) {
+    endBus(parser);
+  } else if (context == kBuses) {
+    // The rest is other modes of transport.
+    parser->done = true;
+  }
+  parser->expecting_key = false;
+}
+
+static void endScalar(DepartureParser* parser) {
+  parser->in_scalar = false;
+  parser->text[parser->text_len] = '\0';
+  value(parser, false);
+}
+
+bool departureParserFeed(DepartureParser* parser, char c) {
+  if (parser->done || parser->failed) {
+    return false;
+  }
+
+  if (parser->in_string) {
+    if (parser->escaped) {
+      parser->escaped = false;
+    } else if (c == '\\') {
+      parser->escaped = true;
+      return true;
+    } else if (c == '"') {
+      parser->in_string = false;
+      parser->text[parser->text_len] = '\0';
+      if (parser->expecting_key) {
+        strcpy(parser->key, parser->text);
+        parser->expecting_key = false;
+      } else {
+        value(parser, true);
+      }
+      return !parser->done && !parser->failed;
+    }
+    if (parser->text_len < kParserMaxText - 1) {
+      parser->text[parser->text_len++] = c;
+    }
+    return true;
+  }
+
+  if (parser->in_scalar) {
+    if (c != ',' && c != '}' && c != ']' && !isspace(c)) {
+      if (parser->text_len < kParserMaxText - 1) {
+        parser->text[parser->text_len++] = c;
+      }
+      return true;
+    }
+    endScalar(parser);
+    // c ends the scalar and is handled below too.
+  }
+
+  switch (c) {
+  case '{':
+    openContainer(parser, true);
+    break;
+  case '[':
+    openContainer(parser, false);
+    break;
+  case '}':
+  case ']':
+    closeContainer(parser);
+    break;
+  case ',':
+    parser->expecting_key = inObject(parser);
+    break;
+  case '"':
+    parser->in_string = true;
+    parser->text_len = 0;
+    break;
+  case ':':
+    break;
+  default:
+    if (!isspace(c)) {
+      parser->in_scalar = true;
+      parser->text_len = 0;
+      parser->text[parser->text_len++] = c;
+    }
+  }
+  return !parser->done && !parser->failed;
+}
+
+int departureParserEnd(DepartureParser* parser) {
+  if (parser->in_scalar) {
+    endScalar(parser);
+  }
+  if (parser->failed) {
+    return kJsonError;
+  }
+  if (parser->status_code > 0) {
+    return parser->status_code;
+  }
+  if (!parser->done && parser->depth != 0) {
+    // Didn't read the full body.
+    return -7;
+  }
+  if (parser->status_code != 0) {
+    return kJsonError;
+  }
+  return 0;
+}
@@ -0,0 +1,70 @@
+#ifndef departure_parser_h
+#define departure_parser_h
+
+#include "bus_description.h"
+
+// Most departures kept per stop. The display shows 7 lines, but the
+// departure cache needs more to count down from between fetches.
+const int kMaxStopDepartures = 12;
+
+const int kJsonError = 5;
+
+const int kParserMaxDepth = 8;
+const int kParserMaxText = 20;
+
+// Incremental parser for an SL realtimedeparturesV4 response. Bytes are fed in
+// as they arrive and only the fields we use are kept, so the body is never
+// held in memory. Buses not heading into town (JourneyDirection 2) or leaving
+// sooner than minimum_mins are dropped as they're parsed.
+struct DepartureParser {
+  // Setup and results
+  int stop_id;
+  int minimum_mins;
+  BusDescription* descs;
+  int count;
+  int status_code;
+  bool done;
+  bool failed;
+  // LatestUpdate plus DataAge in datetimeSeconds() terms, once the response
+  // header has given both, whether or not any bus is kept. 0 until then.
+  long now;
+
+  // ResponseData fields the minutes are worked out from. The API sends them
+  // before the departure lists.
+  char latest_update[kParserMaxText];
+  int data_age;
+  bool have_latest_update;
+  bool have_data_age;
+
+  // Bus being parsed
+  char line_number[kParserMaxText];
+  char expected_time[kParserMaxText];
+  int journey_number;
+  int journey_direction;
+
+  // Tokenizer state: what each open container is, the last key seen, and the
+  // scalar being read.
+  unsigned char context[kParserMaxDepth];
+  int depth;
+  char key[kParserMaxText];
+  bool expecting_key;
+  bool in_string;
+  bool escaped;
+  bool in_scalar;
+  char text[kParserMaxText];
+  int text_len;
+};
+
+// Starts parsing a response for stop_id into descs, which must have room for
+// kMaxStopDepartures.
+void departureParserBegin(DepartureParser* parser, int stop_id, int minimum_mins, BusDescription* descs);
+
+// Feeds the next body byte. Returns false once the parser needs no more
+// input, either because it has all it wants or because the body is malformed.
+bool departureParserFeed(DepartureParser* parser, char c);
+
+// Returns 0 if departures were found, the response's StatusCode if it was
+// non-zero, kJsonError for a malformed response or -7 for a truncated one.
+int departureParserEnd(DepartureParser* parser);
+
+#endif
@@ -25,7 +25,6 @@
  */
 
 #include <stdlib.h>
-#include <ArduinoLowPower.h>
 #include "epd7in5_V2.h"
 
 unsigned char Voltage_Frame_7IN5_V2[]={
@@ -92,9 +91,19 @@ Epd::Epd() {
     busy_pin = BUSY_PIN;
     width = EPD_WIDTH;
     height = EPD_HEIGHT;
+    waveform = EPD_WAVEFORM_FULL;
+    temperature = 0;
+    memset(busy_estimate, 0, sizeof(busy_estimate));
 };
 
-int Epd::Init(void) {
+/**
+ *  @brief: wakes and configures the panel for a waveform profile, falling
+ *          back to EPD_WAVEFORM_FULL when the panel temperature is outside
+ *          EPD_FAST_MIN_TEMP..EPD_FAST_MAX_TEMP, or isn't read because
+ *          EPD_READ_TEMPERATURE is off. Waveform() returns the profile
+ *          actually used.
+ */
+int Epd::Init(int requested_waveform) {
     if (IfInit() != 0) {
         return -1;
     }
@@ -152,8 +161,22 @@ int Epd::Init(void) {
   DelayMs(100);
   WaitUntilIdle();
 
+#ifdef EPD_READ_TEMPERATURE
+  temperature = ReadTemperature();
+#else
+  temperature = EPD_NO_TEMPERATURE;
+#endif
+  waveform = requested_waveform;
+  if (temperature < EPD_FAST_MIN_TEMP || temperature > EPD_FAST_MAX_TEMP) {
+    waveform = EPD_WAVEFORM_FULL;
+  }
+  Serial.print("Epd::Init temperature ");
+  Serial.print(temperature);
+  Serial.print("C, waveform ");
+  Serial.println(waveform);
+
   SendCommand(0X00);			//PANNEL SETTING
-  SendData(0x3F);   //KW-3f   KWR-2F	BWROTP 0f	BWOTP 1f
+  SendData(waveform == EPD_WAVEFORM_FULL ? 0x3F : 0x1F);   //KW-3f   KWR-2F	BWROTP 0f	BWOTP 1f
 
   SendCommand(0x61);        	//tres
   SendData(0x03);		//source 800
@@ -165,8 +188,13 @@ int Epd::Init(void) {
   SendData(0x00);
 
   SendCommand(0X50);			//VCOM AND DATA INTERVAL SETTING
-  SendData(0x10);
-  SendData(0x00);
+  if (waveform == EPD_WAVEFORM_PARTIAL) {
+    SendData(0xA9);
+    SendData(0x07);
+  } else {
+    SendData(0x10);
+    SendData(waveform == EPD_WAVEFORM_FAST ? 0x07 : 0x00);
+  }
 
   SendCommand(0X60);			//TCON SETTING
   SendData(0x22);
@@ -177,15 +205,42 @@ int Epd::Init(void) {
   SendData(0x00);
   SendData(0x00);
 
-  SetLut_by_host(LUT_VCOM_7IN5_V2, LUT_WW_7IN5_V2, LUT_BW_7IN5_V2, LUT_WB_7IN5_V2, LUT_BB_7IN5_V2);
+  if (waveform == EPD_WAVEFORM_FULL) {
+    SetLut_by_host(LUT_VCOM_7IN5_V2, LUT_WW_7IN5_V2, LUT_BW_7IN5_V2, LUT_WB_7IN5_V2, LUT_BB_7IN5_V2);
+  } else {
+    // The OTP holds waveforms for several temperature ranges. Forcing a warm
+    // reading selects one of its short ones.
+    SendCommand(0xE0);  // cascade setting: use the forced temperature
+    SendData(0x02);
+    SendCommand(0xE5);  // force temperature
+    SendData(waveform == EPD_WAVEFORM_FAST ? 0x5A : 0x6E);
+  }
 
   return 0;
 }
 
+int Epd::Waveform(void) {
+    return waveform;
+}
+
+/**
+ *  @brief: reads the panel's internal temperature sensor, in degrees C.
+ *          The answer comes back on DIN, so this needs DIN wired to MISO as
+ *          well; see EPD_READ_TEMPERATURE.
+ */
+int Epd::ReadTemperature(void) {
+    SendCommand(0x40);
+    DigitalWrite(dc_pin, HIGH);
+    signed char degrees = (signed char)SpiReceive();
+    SpiReceive();  // half degree bit
+    return degrees;
+}
+
 /**
  *  @brief: basic function for sending commands
  */
 void Epd::SendCommand(unsigned char command) {
+    SpiWait();
     DigitalWrite(dc_pin, LOW);
     SpiTransfer(command);
 }
@@ -194,22 +249,78 @@ void Epd::SendCommand(unsigned char command) {
  *  @brief: basic function for sending data
  */
 void Epd::SendData(unsigned char data) {
+    SpiWait();
     DigitalWrite(dc_pin, HIGH);
     SpiTransfer(data);
 }
 
 /**
- *  @brief: Wait until the busy_pin goes HIGH
+ *  @brief: sends len data bytes with DC set once and CS held low across the
+ *          block. The transfer may still be running on return (see
+ *          EpdIf::SpiTransferBlock), so data must not be reused until the
+ *          next Send*() call.
  */
-void Epd::WaitUntilIdle(void) {
-    unsigned char busy;
-    //Serial.print("e-Paper Busy\r\n ");
-    do{
-        SendCommand(0x71);
-        busy = DigitalRead(busy_pin);
-    }while(busy == 0);
-    //Serial.print("e-Paper Busy Release\r\n ");
+void Epd::SendDataBlock(const unsigned char* data, unsigned long len) {
+    SpiWait();
+    DigitalWrite(dc_pin, HIGH);
+    SpiTransferBlock(data, len);
+}
+
+/**
+ *  @brief: sends a run of blank data bytes
+ */
+void Epd::SendZeros(unsigned long count) {
+    SpiWait();
+    DigitalWrite(dc_pin, HIGH);
+    SpiTransferRepeat(0x00, count);
+}
+
+/**
+ *  @brief: logs how fast the bytes sent since start_bytes at start_micros
+ *          went out
+ */
+void Epd::LogThroughput(unsigned long start_bytes, unsigned long start_micros) {
+  unsigned long bytes = spi_bytes - start_bytes;
+  unsigned long elapsed = micros() - start_micros;
+  Serial.print("Epd sent ");
+  Serial.print(bytes);
+  Serial.print(" bytes in ");
+  Serial.print(elapsed);
+  Serial.print("us, ");
+  Serial.print(elapsed ? (unsigned long)((unsigned long long)bytes * 1000000 / elapsed) : 0);
+  Serial.println(" bytes/s");
+}
+
+/**
+ *  @brief: Wait until the busy_pin goes HIGH, for at most timeout_ms.
+ *          The MCU sleeps in standby until BUSY's rising edge wakes it,
+ *          except with a serial connection, which standby would drop, when
+ *          the pin is polled instead. Returns how long BUSY was low in ms,
+ *          or -1 on timeout.
+ */
+long Epd::WaitUntilIdle(unsigned long timeout_ms) {
+    SpiWait();
+    // Kept in ticks, as the clock wraps
+    unsigned long start = ClockTicks();
+    unsigned long timeout = MsToTicks(timeout_ms);
+    unsigned long elapsed = 0;
+    while (DigitalRead(busy_pin) == LOW) {
+        elapsed = ClockTicks() - start;
+        if (elapsed >= timeout) {
+            Serial.print("e-Paper busy timeout after ");
+            Serial.print(TicksToMs(elapsed));
+            Serial.println("ms");
+            return -1;
+        }
+        if (Serial) {
+            DelayMs(1);
+        } else {
+            SleepUntilRise(busy_pin, TicksToMs(timeout - elapsed));
+        }
+    }
+    elapsed = ClockTicks() - start;
     DelayMs(20);
+    return TicksToMs(elapsed);
 }
 
 /**
@@ -235,17 +346,228 @@ void Epd::DisplayBytes(unsigned char (*next_byte)(bool, int, int)) {
       }
   }
   SendCommand(0x12);
-  if (!Serial) {
-    LowPower.deepSleep(2000);
-  } else {
-    Serial.println("Simulating sleep for 2 seconds");
-    delay(2000);
-  }
-  Serial.println("Epd::DisplayBytes waiting until idle");
-  WaitUntilIdle();
+  WaitForRefresh();
   Serial.println("Epd::DisplayBytes returning");
 }
 
+/**
+ *  @brief: like DisplayBytes, but fill_rows(band, y, rows) renders whole rows
+ *          at a time into a buffer of rows * width/8 bytes, which is then sent
+ *          as a block while the next band renders into a second buffer.
+ *          If given, row_span(y, &first, &end) returns false for a blank row
+ *          or narrows it to the byte columns [first, end) that may hold ink;
+ *          bands with no ink are streamed as zeros without calling fill_rows.
+ *          The fast waveform drives each pixel by its old and new values, so
+ *          it needs old_rows and old_span for what the panel shows now, as
+ *          DisplayWindow does; the controller forgets them in deep sleep.
+ */
+void Epd::DisplayRows(void (*fill_rows)(unsigned char*, int, int), bool (*row_span)(int, int*, int*),
+                      void (*old_rows)(unsigned char*, int, int), bool (*old_span)(int, int*, int*)) {
+  Serial.println("Epd::DisplayRows");
+  unsigned long start = millis();
+  unsigned long start_micros = micros();
+  unsigned long start_bytes = spi_bytes;
+  blank_bytes = 0;
+  if (old_rows) {
+    SendCommand(0x10);
+    SendRows(old_rows, old_span, 0, height, 0, width/8);
+  }
+  SendCommand(0x13);
+  SendRows(fill_rows, row_span, 0, height, 0, width/8);
+  SendCommand(0x12);
+  LogThroughput(start_bytes, start_micros);
+  Serial.print("Epd::DisplayRows sent frame in ");
+  Serial.print(millis() - start);
+  Serial.print("ms, blank bytes: ");
+  Serial.print(blank_bytes);
+  Serial.print("/");
+  Serial.println((old_rows ? 2 : 1) * height * width/8);
+  WaitForRefresh();
+  Serial.println("Epd::DisplayRows returning");
+}
+
+/**
+ *  @brief: refreshes only the window at x, y of w by h pixels using the
+ *          controller's partial mode, with the same callbacks as DisplayRows.
+ *          old_rows and old_span give what the panel shows now, which the
+ *          waveform needs and the controller forgets in deep sleep.
+ *          x and w must be multiples of 8.
+ */
+void Epd::DisplayWindow(void (*fill_rows)(unsigned char*, int, int), bool (*row_span)(int, int*, int*),
+                        void (*old_rows)(unsigned char*, int, int), bool (*old_span)(int, int*, int*),
+                        unsigned long x, unsigned long y, unsigned long w, unsigned long h) {
+  Serial.println("Epd::DisplayWindow");
+  unsigned long start = millis();
+  unsigned long start_micros = micros();
+  unsigned long start_bytes = spi_bytes;
+  unsigned long x_end = x + w - 1;
+  unsigned long y_end = y + h - 1;
+
+  SendCommand(0x91);  // partial in
+  SendCommand(0x90);  // partial window
+  SendData(x >> 8);
+  SendData(x & 0xF8);
+  SendData(x_end >> 8);
+  SendData(x_end | 0x07);
+  SendData(y >> 8);
+  SendData(y & 0xFF);
+  SendData(y_end >> 8);
+  SendData(y_end & 0xFF);
+  SendData(0x01);  // gates scan both inside and outside the window
+
+  blank_bytes = 0;
+  SendCommand(0x10);
+  SendRows(old_rows, old_span, y, h, x/8, (x + w)/8);
+  SendCommand(0x13);
+  SendRows(fill_rows, row_span, y, h, x/8, (x + w)/8);
+  SendCommand(0x12);
+  LogThroughput(start_bytes, start_micros);
+  Serial.print("Epd::DisplayWindow sent ");
+  Serial.print(w);
+  Serial.print("x");
+  Serial.print(h);
+  Serial.print(" window in ");
+  Serial.print(millis() - start);
+  Serial.print("ms, blank bytes: ");
+  Serial.print(blank_bytes);
+  Serial.print("/");
+  Serial.println(2 * h * w/8);
+  WaitForRefresh();
+  SendCommand(0x92);  // partial out
+  Serial.println("Epd::DisplayWindow returning");
+}
+
+/**
+ *  @brief: streams rows y to y + rows - 1, byte columns first_col to end_col,
+ *          rendering only the bands row_span reports ink in. Within those,
+ *          each row is narrowed to its own span again, and the blank bytes
+ *          either side are sent as runs of zeros. Adjacent blank runs, and
+ *          inked spans that follow on in the buffer, go out as one transfer.
+ *          Bands alternate between the two buffers, so one can render while
+ *          the other sends.
+ */
+void Epd::SendRows(void (*fill_rows)(unsigned char*, int, int), bool (*row_span)(int, int*, int*),
+                   unsigned long y, unsigned long rows, int first_col, int end_col) {
+  int row_bytes = width/8;
+  int cols = end_col - first_col;
+  int first[EPD_BAND_ROWS];
+  int end[EPD_BAND_ROWS];
+  int next_band = 0;
+  // Zeros owed, or rendered bytes not yet sent; never both at once, so the
+  // run goes out before any zeros that follow it are counted.
+  unsigned long zeros = 0;
+  const unsigned char* run = nullptr;
+  unsigned long run_len = 0;
+  for (unsigned long band_y = y; band_y < y + rows; band_y += EPD_BAND_ROWS) {
+      int band_rows = (y + rows - band_y < EPD_BAND_ROWS) ? y + rows - band_y : EPD_BAND_ROWS;
+      bool band_blank = true;
+      for (int r = 0; r < band_rows; r++) {
+        first[r] = 0;
+        end[r] = row_bytes;
+        if (row_span && !(*row_span)(band_y + r, &first[r], &end[r])) {
+          first[r] = end[r] = end_col;
+        }
+        first[r] = constrain(first[r], first_col, end_col);
+        end[r] = constrain(end[r], first[r], end_col);
+        band_blank = band_blank && first[r] == end[r];
+      }
+      if (band_blank) {
+        if (run_len) {
+          SendDataBlock(run, run_len);
+          run_len = 0;
+        }
+        zeros += band_rows * cols;
+        blank_bytes += band_rows * cols;
+        continue;
+      }
+
+      // The pending run is in the buffer about to be rendered into.
+      if (run_len) {
+        SendDataBlock(run, run_len);
+        run_len = 0;
+      }
+      unsigned char* buffer = band[next_band];
+      next_band ^= 1;
+      (*fill_rows)(buffer, band_y, band_rows);
+      for (int r = 0; r < band_rows; r++) {
+        blank_bytes += cols - (end[r] - first[r]);
+        if (first[r] > first_col) {
+          if (run_len) {
+            SendDataBlock(run, run_len);
+            run_len = 0;
+          }
+          zeros += first[r] - first_col;
+        }
+        if (first[r] < end[r]) {
+          const unsigned char* data = buffer + r * row_bytes + first[r];
+          if (zeros) {
+            SendZeros(zeros);
+            zeros = 0;
+          } else if (run_len && run + run_len != data) {
+            SendDataBlock(run, run_len);
+            run_len = 0;
+          }
+          if (run_len == 0) {
+            run = data;
+          }
+          run_len += end[r] - first[r];
+        }
+        if (end[r] < end_col) {
+          if (run_len) {
+            SendDataBlock(run, run_len);
+            run_len = 0;
+          }
+          zeros += end_col - end[r];
+        }
+      }
+  }
+  if (run_len) {
+    SendDataBlock(run, run_len);
+  }
+  if (zeros) {
+    SendZeros(zeros);
+  }
+}
+
+/**
+ *  @brief: waits out a refresh started with command 0x12. Once this
+ *          waveform and temperature band has been timed, it sleeps through
+ *          most of the predicted time without watching BUSY, then waits for
+ *          BUSY to confirm. Logs predicted and actual time and folds the
+ *          actual time into the estimate.
+ */
+void Epd::WaitForRefresh(void) {
+  int band = constrain(temperature / 10, 0, EPD_TEMP_BANDS - 1);
+  unsigned long* estimate = &busy_estimate[waveform][band];
+  unsigned long predicted = *estimate;
+  unsigned long start = ClockTicks();
+  if (predicted) {
+    // Wake a little early: the estimate is an average, and waking early only
+    // costs a short wait on BUSY where waking late wastes the overrun.
+    unsigned long nap = predicted - predicted / 8;
+    if (Serial) {
+      DelayMs(nap);
+    } else {
+      SleepMs(nap);
+    }
+  }
+  if (WaitUntilIdle() < 0) {
+    return;
+  }
+  unsigned long actual = TicksToMs(ClockTicks() - start);
+  *estimate = predicted ? (3 * predicted + actual) / 4 : actual;
+
+  Serial.print("Epd::WaitForRefresh waveform ");
+  Serial.print(waveform);
+  Serial.print(" at ");
+  Serial.print(temperature);
+  Serial.print("C predicted ");
+  Serial.print(predicted);
+  Serial.print("ms, took ");
+  Serial.print(actual);
+  Serial.println("ms");
+}
+
 void Epd::DisplayPattern(bool (*pixel_on)(int, int)) {
     SendCommand(0x13);
     for (unsigned long y = 0; y < height; y++) {
@@ -296,27 +618,20 @@ void Epd::Displaypart(const unsigned char* pbuffer, unsigned long xStart, unsign
 
 void Epd::SetLut_by_host(unsigned char* lut_vcom,  unsigned char* lut_ww, unsigned char* lut_bw, unsigned char* lut_wb, unsigned char* lut_bb)
 {
-	unsigned char count;
-
 	SendCommand(0x20); //VCOM	
-	for(count=0; count<42; count++)
-		SendData(lut_vcom[count]);
+	SendDataBlock(lut_vcom, 42);
 
 	SendCommand(0x21); //LUTBW
-	for(count=0; count<42; count++)
-		SendData(lut_ww[count]);
+	SendDataBlock(lut_ww, 42);
 
 	SendCommand(0x22); //LUTBW
-	for(count=0; count<42; count++)
-		SendData(lut_bw[count]);
+	SendDataBlock(lut_bw, 42);
 
 	SendCommand(0x23); //LUTWB
-	for(count=0; count<42; count++)
-		SendData(lut_wb[count]);
+	SendDataBlock(lut_wb, 42);
 
 	SendCommand(0x24); //LUTBB
-	for(count=0; count<42; count++)
-		SendData(lut_bb[count]);
+	SendDataBlock(lut_bb, 42);
 }
 
 /**
@@ -32,23 +32,56 @@
 // Display resolution
 #define EPD_WIDTH 800
 #define EPD_HEIGHT 480
+// Rows rendered and sent per call to a DisplayRows() callback
+#define EPD_BAND_ROWS 8
+
+// Waveform profiles for Init()
+#define EPD_WAVEFORM_FULL       0   // host LUT, cleanest image, slowest
+#define EPD_WAVEFORM_FAST       1   // OTP LUT for a forced warm temperature
+#define EPD_WAVEFORM_PARTIAL    2   // OTP LUT for partial windows, fastest
+// Panel temperatures (degrees C) the fast and partial profiles are used in.
+// Outside this range, or if the sensor can't be read, Init() uses the full one.
+#define EPD_FAST_MIN_TEMP       10
+#define EPD_FAST_MAX_TEMP       40
+// Read the panel's temperature sensor in Init() to allow the fast and partial
+// profiles. The answer comes back on DIN, so only define this with DIN wired
+// to MISO as well; a floating MISO can read as a plausible temperature.
+// Without it Init() always uses the full profile.
+// #define EPD_READ_TEMPERATURE
+// Init()'s temperature when the sensor isn't read
+#define EPD_NO_TEMPERATURE      -128
+// Longest WaitUntilIdle() waits for BUSY by default, in ms
+#define EPD_BUSY_TIMEOUT_MS     30000
+// Refresh times are learnt per waveform and per 10 degree band of panel
+// temperature, from below 10C to 30C and up
+#define EPD_WAVEFORMS           3
+#define EPD_TEMP_BANDS          4
 
 class Epd : EpdIf {
 public:
   Epd();
   ~Epd();
-  int Init(void);
-  void WaitUntilIdle(void);
+  int Init(int requested_waveform = EPD_WAVEFORM_FULL);
+  int Waveform(void);
+  int ReadTemperature(void);
+  long WaitUntilIdle(unsigned long timeout_ms = EPD_BUSY_TIMEOUT_MS);
   void Reset(void);
   void SetLut(void);
   void DisplayFrame(const unsigned char *frame_buffer);
   void SendCommand(unsigned char command);
   void SendData(unsigned char data);
+  void SendDataBlock(const unsigned char* data, unsigned long len);
+  void SendZeros(unsigned long count);
   void Sleep(void);
   void Clear(void);
   void Displaypart(const unsigned char *pbuffer, unsigned long Start_X, unsigned long Start_Y, unsigned long END_X, unsigned long END_Y);
   void DisplayPattern(bool (*pixel_on)(int, int));
   void DisplayBytes(unsigned char (*next_byte)(bool, int, int));
+  void DisplayRows(void (*fill_rows)(unsigned char*, int, int), bool (*row_span)(int, int*, int*) = nullptr,
+                   void (*old_rows)(unsigned char*, int, int) = nullptr, bool (*old_span)(int, int*, int*) = nullptr);
+  void DisplayWindow(void (*fill_rows)(unsigned char*, int, int), bool (*row_span)(int, int*, int*),
+                     void (*old_rows)(unsigned char*, int, int), bool (*old_span)(int, int*, int*),
+                     unsigned long x, unsigned long y, unsigned long w, unsigned long h);
 
 private:
   unsigned int reset_pin;
@@ -57,8 +90,22 @@ private:
   unsigned int busy_pin;
   unsigned long width;
   unsigned long height;
+  // Profile chosen by the last Init(), and the temperature it was chosen at
+  int waveform;
+  int temperature;
+  // Running estimate of refresh busy time in ms, 0 until first measured. The
+  // Epd lives in RAM that standby keeps, so this carries across wakes.
+  unsigned long busy_estimate[EPD_WAVEFORMS][EPD_TEMP_BANDS];
+  // Two band buffers, so one can render while the other is being sent
+  unsigned char band[2][EPD_WIDTH / 8 * EPD_BAND_ROWS];
+  // Bytes of the last frame or window that were sent as blank runs without rendering
+  unsigned long blank_bytes;
 
   void SetLut(unsigned char *lut);
+  void WaitForRefresh(void);
+  void LogThroughput(unsigned long start_bytes, unsigned long start_micros);
+  void SendRows(void (*fill_rows)(unsigned char*, int, int), bool (*row_span)(int, int*, int*),
+                unsigned long y, unsigned long rows, int first_col, int end_col);
   void SetLut_by_host(unsigned char *lut_vcom, unsigned char *lut_ww, unsigned char *lut_bw, unsigned char *lut_wb, unsigned char *lut_bb);
 };
 
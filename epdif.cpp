@@ -27,6 +27,66 @@
 
 #include "epdif.h"
 #include <SPI.h>
+#include <ArduinoLowPower.h>
+
+unsigned long EpdIf::spi_bytes = 0;
+
+#ifdef EPD_USE_DMA
+// DMAC channel 0 descriptor and write-back area. The DMAC reads channel n's
+// descriptor at BASEADDR + 16 * n, so with one channel these are all it needs.
+static DmacDescriptor dma_descriptor __attribute__((aligned(16)));
+static DmacDescriptor dma_writeback __attribute__((aligned(16)));
+static bool dma_ready = false;
+static bool dma_busy = false;
+// Source for SpiTransferRepeat(), which must outlive the transfer
+static unsigned char repeat_value;
+#endif
+
+#ifdef ARDUINO_ARCH_SAMD
+// Set from the wake interrupt SleepUntilRise() arms
+static volatile bool pin_rose = false;
+static bool clock_ready = false;
+
+static void PinRose(void) {
+    pin_rose = true;
+}
+
+// The standby clock's compare match only needs to wake the CPU.
+void TC4_Handler(void) {
+    TC4->COUNT32.INTFLAG.reg = TC_INTFLAG_MC0;
+}
+
+/**
+ *  @brief: runs TC4/TC5 as a 32-bit counter at 1024 Hz from the ultra low
+ *          power 32 kHz oscillator on GCLK4. Unlike millis(), it keeps
+ *          counting in standby.
+ */
+static void ClockSetup(void) {
+    GCLK->GENDIV.reg = GCLK_GENDIV_ID(4) | GCLK_GENDIV_DIV(1);
+    GCLK->GENCTRL.reg = GCLK_GENCTRL_ID(4) | GCLK_GENCTRL_SRC_OSCULP32K | GCLK_GENCTRL_GENEN | GCLK_GENCTRL_RUNSTDBY;
+    while (GCLK->STATUS.bit.SYNCBUSY) {}
+    GCLK->CLKCTRL.reg = GCLK_CLKCTRL_ID_TC4_TC5 | GCLK_CLKCTRL_GEN_GCLK4 | GCLK_CLKCTRL_CLKEN;
+    while (GCLK->STATUS.bit.SYNCBUSY) {}
+    PM->APBCMASK.reg |= PM_APBCMASK_TC4 | PM_APBCMASK_TC5;
+
+    TC4->COUNT32.CTRLA.reg = TC_CTRLA_SWRST;
+    while (TC4->COUNT32.CTRLA.bit.SWRST) {}
+    TC4->COUNT32.CTRLA.reg = TC_CTRLA_MODE_COUNT32 | TC_CTRLA_PRESCALER_DIV32 | TC_CTRLA_RUNSTDBY;
+    TC4->COUNT32.CTRLA.reg |= TC_CTRLA_ENABLE;
+    while (TC4->COUNT32.STATUS.bit.SYNCBUSY) {}
+    NVIC_EnableIRQ(TC4_IRQn);
+    clock_ready = true;
+}
+
+static uint32_t ReadClock(void) {
+    if (!clock_ready) {
+        ClockSetup();
+    }
+    TC4->COUNT32.READREQ.reg = TC_READREQ_RREQ | TC_READREQ_ADDR(0x10);
+    while (TC4->COUNT32.STATUS.bit.SYNCBUSY) {}
+    return TC4->COUNT32.COUNT.reg;
+}
+#endif
 
 EpdIf::EpdIf() {
 };
@@ -35,7 +95,18 @@ EpdIf::~EpdIf() {
 };
 
 void EpdIf::DigitalWrite(int pin, int value) {
+#ifdef ARDUINO_ARCH_SAMD
+    // Straight to the port's set/clear registers; digitalWrite() costs more
+    // than a byte of SPI at 7 MHz. All our outputs are set up by IfInit().
+    const PinDescription& desc = g_APinDescription[pin];
+    if (value) {
+        PORT->Group[desc.ulPort].OUTSET.reg = 1ul << desc.ulPin;
+    } else {
+        PORT->Group[desc.ulPort].OUTCLR.reg = 1ul << desc.ulPin;
+    }
+#else
     digitalWrite(pin, value);
+#endif
 }
 
 int EpdIf::DigitalRead(int pin) {
@@ -47,9 +118,244 @@ void EpdIf::DelayMs(unsigned int delaytime) {
 }
 
 void EpdIf::SpiTransfer(unsigned char data) {
-    digitalWrite(CS_PIN, LOW);
+    SpiWait();
+    DigitalWrite(CS_PIN, LOW);
     SPI.transfer(data);
-    digitalWrite(CS_PIN, HIGH);
+    DigitalWrite(CS_PIN, HIGH);
+    spi_bytes++;
+}
+
+unsigned char EpdIf::SpiReceive(void) {
+    SpiWait();
+    DigitalWrite(CS_PIN, LOW);
+    unsigned char data = SPI.transfer(0xFF);
+    DigitalWrite(CS_PIN, HIGH);
+    return data;
+}
+
+#ifdef ARDUINO_ARCH_SAMD
+/**
+ *  @brief: waits for the last byte to leave the shift register, then drops
+ *          whatever was received meanwhile so the next SPI.transfer() reads
+ *          its own reply.
+ */
+static void SpiDrain(void) {
+    while (!(EPD_SPI_SERCOM->SPI.INTFLAG.reg & SERCOM_SPI_INTFLAG_TXC)) {}
+    while (EPD_SPI_SERCOM->SPI.INTFLAG.reg & SERCOM_SPI_INTFLAG_RXC) {
+        (void)EPD_SPI_SERCOM->SPI.DATA.reg;
+    }
+    EPD_SPI_SERCOM->SPI.STATUS.reg = SERCOM_SPI_STATUS_BUFOVF;
+}
+#endif
+
+#ifdef EPD_USE_DMA
+static void DmaSetup(void) {
+    PM->AHBMASK.reg |= PM_AHBMASK_DMAC;
+    PM->APBBMASK.reg |= PM_APBBMASK_DMAC;
+    DMAC->CTRL.reg = 0;
+    DMAC->CTRL.reg = DMAC_CTRL_SWRST;
+    DMAC->BASEADDR.reg = (uint32_t)&dma_descriptor;
+    DMAC->WRBADDR.reg = (uint32_t)&dma_writeback;
+    DMAC->CTRL.reg = DMAC_CTRL_DMAENABLE | DMAC_CTRL_LVLEN(0xf);
+
+    DMAC->CHID.reg = DMAC_CHID_ID(0);
+    DMAC->CHCTRLA.reg = 0;
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_SWRST;
+    DMAC->CHCTRLB.reg = DMAC_CHCTRLB_LVL(0) | DMAC_CHCTRLB_TRIGSRC(EPD_SPI_DMAC_ID_TX) | DMAC_CHCTRLB_TRIGACT_BEAT;
+    dma_ready = true;
+}
+
+/**
+ *  @brief: starts a byte-wide DMA transfer into the SPI data register, one
+ *          beat per free slot in the transmit buffer. With increment false,
+ *          the same source byte is sent count times. count <= 65535.
+ */
+static void DmaStart(const unsigned char* src, unsigned long count, bool increment) {
+    dma_descriptor.BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_BYTE | DMAC_BTCTRL_BLOCKACT_NOACT |
+                                (increment ? DMAC_BTCTRL_SRCINC : 0);
+    dma_descriptor.BTCNT.reg = count;
+    // With SRCINC the DMAC wants the address just past the last byte
+    dma_descriptor.SRCADDR.reg = (uint32_t)src + (increment ? count : 0);
+    dma_descriptor.DSTADDR.reg = (uint32_t)&EPD_SPI_SERCOM->SPI.DATA.reg;
+    dma_descriptor.DESCADDR.reg = 0;
+    DMAC->CHID.reg = DMAC_CHID_ID(0);
+    DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_TCMPL;
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_ENABLE;
+    dma_busy = true;
+}
+#endif
+
+/**
+ *  @brief: finishes any block transfer still in flight and releases CS.
+ *          Call it before changing DC or touching the data of the last
+ *          SpiTransferBlock().
+ */
+void EpdIf::SpiWait(void) {
+#ifdef EPD_USE_DMA
+    if (!dma_busy) {
+        return;
+    }
+    DMAC->CHID.reg = DMAC_CHID_ID(0);
+    while (!(DMAC->CHINTFLAG.reg & DMAC_CHINTFLAG_TCMPL)) {}
+    SpiDrain();
+    DigitalWrite(CS_PIN, HIGH);
+    dma_busy = false;
+#endif
+}
+
+/**
+ *  @brief: sends len bytes with CS held low throughout. With EPD_USE_DMA this
+ *          returns as soon as the transfer has started, so data must be left
+ *          alone until SpiWait() or the next transfer, which both wait for it.
+ */
+void EpdIf::SpiTransferBlock(const unsigned char* data, unsigned long len) {
+    SpiWait();
+    if (len == 0) {
+        return;
+    }
+    spi_bytes += len;
+#ifdef EPD_USE_DMA
+    if (len <= 0xFFFF) {
+        if (!dma_ready) {
+            DmaSetup();
+        }
+        DigitalWrite(CS_PIN, LOW);
+        DmaStart(data, len, true);
+        return;
+    }
+#endif
+    DigitalWrite(CS_PIN, LOW);
+#ifdef ARDUINO_ARCH_SAMD
+    // Keep the transmit buffer full instead of waiting for every reply, as
+    // SPI.transfer() does.
+    for (unsigned long i = 0; i < len; i++) {
+        while (!(EPD_SPI_SERCOM->SPI.INTFLAG.reg & SERCOM_SPI_INTFLAG_DRE)) {}
+        EPD_SPI_SERCOM->SPI.DATA.reg = data[i];
+    }
+    SpiDrain();
+#else
+    for (unsigned long i = 0; i < len; i++) {
+        SPI.transfer(data[i]);
+    }
+#endif
+    DigitalWrite(CS_PIN, HIGH);
+}
+
+/**
+ *  @brief: sends value count times with CS held low, asynchronously with
+ *          EPD_USE_DMA as for SpiTransferBlock().
+ */
+void EpdIf::SpiTransferRepeat(unsigned char value, unsigned long count) {
+#ifdef EPD_USE_DMA
+    while (count > 0) {
+        SpiWait();
+        if (!dma_ready) {
+            DmaSetup();
+        }
+        unsigned long chunk = count > 0xFFFF ? 0xFFFF : count;
+        repeat_value = value;
+        spi_bytes += chunk;
+        DigitalWrite(CS_PIN, LOW);
+        DmaStart(&repeat_value, chunk, false);
+        count -= chunk;
+    }
+#else
+    if (count == 0) {
+        return;
+    }
+    spi_bytes += count;
+    DigitalWrite(CS_PIN, LOW);
+#ifdef ARDUINO_ARCH_SAMD
+    while (count--) {
+        while (!(EPD_SPI_SERCOM->SPI.INTFLAG.reg & SERCOM_SPI_INTFLAG_DRE)) {}
+        EPD_SPI_SERCOM->SPI.DATA.reg = value;
+    }
+    SpiDrain();
+#else
+    while (count--) {
+        SPI.transfer(value);
+    }
+#endif
+    DigitalWrite(CS_PIN, HIGH);
+#endif
+}
+
+/**
+ *  @brief: EPD_CLOCK_HZ ticks from a clock that keeps running while the MCU
+ *          is in standby, for timing waits that sleep. The count wraps, so
+ *          only unsigned differences between readings are meaningful;
+ *          convert them to ms with TicksToMs().
+ */
+unsigned long EpdIf::ClockTicks(void) {
+#ifdef ARDUINO_ARCH_SAMD
+    return ReadClock();
+#else
+    return millis();
+#endif
+}
+
+#ifdef ARDUINO_ARCH_SAMD
+/**
+ *  @brief: standby until the standby clock has run for ms, or until pin
+ *          rises if pin >= 0. Other interrupts may end it early too.
+ */
+static void Standby(int pin, unsigned long ms) {
+    uint32_t wake = ReadClock() + EpdIf::MsToTicks(ms) + 1;
+    TC4->COUNT32.CC[0].reg = wake;
+    while (TC4->COUNT32.STATUS.bit.SYNCBUSY) {}
+    TC4->COUNT32.INTFLAG.reg = TC_INTFLAG_MC0;
+    TC4->COUNT32.INTENSET.reg = TC_INTENSET_MC0;
+
+    pin_rose = false;
+    if (pin >= 0) {
+        LowPower.attachInterruptWakeup(pin, PinRose, RISING);
+    }
+    // With interrupts masked, an edge arriving after the check still ends
+    // the WFI, so it can't be missed.
+    SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+    __disable_irq();
+    if (!pin_rose && (pin < 0 || digitalRead(pin) == LOW)) {
+        __DSB();
+        __WFI();
+    }
+    __enable_irq();
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+
+    if (pin >= 0) {
+        detachInterrupt(digitalPinToInterrupt(pin));
+    }
+    TC4->COUNT32.INTENCLR.reg = TC_INTENCLR_MC0;
+}
+#endif
+
+/**
+ *  @brief: puts the MCU in standby until pin rises or timeout_ms passes.
+ *          It may also return early on any other interrupt, so callers
+ *          check the pin and the time themselves.
+ */
+void EpdIf::SleepUntilRise(int pin, unsigned long timeout_ms) {
+#ifdef ARDUINO_ARCH_SAMD
+    Standby(pin, timeout_ms);
+#else
+    (void)pin;
+    delay(timeout_ms < 10 ? timeout_ms : 10);
+#endif
+}
+
+/**
+ *  @brief: puts the MCU in standby for ms, by the standby clock.
+ */
+void EpdIf::SleepMs(unsigned long ms) {
+#ifdef ARDUINO_ARCH_SAMD
+    unsigned long start = ClockTicks();
+    unsigned long ticks = MsToTicks(ms);
+    unsigned long elapsed;
+    while ((elapsed = ClockTicks() - start) < ticks) {
+        Standby(-1, TicksToMs(ticks - elapsed));
+    }
+#else
+    delay(ms);
+#endif
 }
 
 int EpdIf::IfInit(void) {
@@ -62,4 +368,3 @@ int EpdIf::IfInit(void) {
 
     return 0;
 }
-
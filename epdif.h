@@ -35,6 +35,19 @@
 #define DC_PIN          4//9
 #define CS_PIN          7//10
 #define BUSY_PIN        6//7
+
+#ifdef ARDUINO_ARCH_SAMD
+// SERCOM behind the SPI header (SERCOM1 on the MKR boards) and its DMA trigger
+#define EPD_SPI_SERCOM          SERCOM1
+#define EPD_SPI_DMAC_ID_TX      SERCOM1_DMAC_ID_TX
+// Send blocks by DMA on DMAC channel 0 instead of register writes. This takes
+// over the DMAC descriptor base, so comment it out if another library uses DMA.
+#define EPD_USE_DMA
+// Rate of EpdIf::ClockTicks(), the standby clock
+#define EPD_CLOCK_HZ            1024
+#else
+#define EPD_CLOCK_HZ            1000
+#endif
  
 class EpdIf {
 public:
@@ -46,6 +59,22 @@ public:
     static int  DigitalRead(int pin);
     static void DelayMs(unsigned int delaytime);
     static void SpiTransfer(unsigned char data);
+    static unsigned char SpiReceive(void);
+    static void SpiTransferBlock(const unsigned char* data, unsigned long len);
+    static void SpiTransferRepeat(unsigned char value, unsigned long count);
+    static void SpiWait(void);
+    static unsigned long ClockTicks(void);
+    static unsigned long TicksToMs(unsigned long ticks) {
+        return (unsigned long)((unsigned long long)ticks * 1000 / EPD_CLOCK_HZ);
+    }
+    static unsigned long MsToTicks(unsigned long ms) {
+        return (unsigned long)((unsigned long long)ms * EPD_CLOCK_HZ / 1000);
+    }
+    static void SleepUntilRise(int pin, unsigned long timeout_ms);
+    static void SleepMs(unsigned long ms);
+
+    // Bytes clocked out to the panel since power-on
+    static unsigned long spi_bytes;
 };
 
 #endif
@@ -0,0 +1,229 @@
+#include <Arduino.h>
+
+#include "http_connection.h"
+#include "logging.h"
+
+enum {
+  kChunkSize,
+  kChunkExtension,
+  kChunkData,
+  kChunkDataEnd,
+  kChunkTrailer,
+};
+
+static void resetResponse(HttpResponse* response) {
+  memset(response, 0, sizeof(HttpResponse));
+  response->remaining = -1;
+  response->chunk_state = kChunkSize;
+}
+
+void httpBegin(HttpConnection* connection, Client* client, const char* host, int port) {
+  memset(connection, 0, sizeof(HttpConnection));
+  connection->client = client;
+  connection->host = host;
+  connection->port = port;
+  resetResponse(&connection->response);
+}
+
+void httpStop(HttpConnection* connection) {
+  connection->client->stop();
+  connection->ring_start = 0;
+  connection->ring_count = 0;
+  connection->pending = 0;
+  connection->closing = false;
+  resetResponse(&connection->response);
+}
+
+int httpSendGet(HttpConnection* connection, const char* path) {
+  Client* client = connection->client;
+  if (connection->closing || !client->connected()) {
+    httpStop(connection);
+    unsigned long start = millis();
+    if (!client->connect(connection->host, connection->port)) {
+      Serial.println("connect failed");
+      return -1;
+    }
+    connection->handshakes++;
+    DEBUG_PRINT("Connected in ");
+    DEBUG_PRINT(millis() - start);
+    DEBUG_PRINTLN(" ms");
+  }
+  if (connection->pending == kMaxPipelined) {
+    return -3;
+  }
+
+  char request[160];
+  int len = snprintf(request, sizeof(request),
+                     "GET %s HTTP/1.1\r\nHost: %s\r\nUser-Agent: Arduino\r\nConnection: keep-alive\r\n\r\n",
+                     path, connection->host);
+  if (len >= (int)sizeof(request) || client->write((const uint8_t*)request, len) != (size_t)len) {
+    httpStop(connection);
+    return -2;
+  }
+  connection->pending++;
+  return 0;
+}
+
+void httpNextResponse(HttpConnection* connection) {
+  if (connection->pending > 0) {
+    connection->pending--;
+  }
+  resetResponse(&connection->response);
+}
+
+// Moves whatever the socket has into the free end of the ring. Returns the
+// number of bytes moved.
+static int pull(HttpConnection* connection) {
+  Client* client = connection->client;
+  int available = client->available();
+  if (available <= 0 || connection->ring_count == kHttpRingSize) {
+    return 0;
+  }
+  int end = (connection->ring_start + connection->ring_count) % kHttpRingSize;
+  // Only the contiguous free run; the next pull gets the rest.
+  int space = end < connection->ring_start ? connection->ring_start - end : kHttpRingSize - end;
+  int n = client->read(connection->ring + end, available < space ? available : space);
+  if (n <= 0) {
+    return 0;
+  }
+  connection->ring_count += n;
+  connection->bytes_received += n;
+  return n;
+}
+
+// Whether line, lower cased, is the header name followed by a value
+// containing token. Pass NULL for any value.
+static bool headerIs(const char* line, const char* name, const char* token) {
+  int len = strlen(name);
+  if (strncmp(line, name, len) != 0 || line[len] != ':') {
+    return false;
+  }
+  return token == NULL || strstr(line + len + 1, token) != NULL;
+}
+
+// Steps the status line and headers over one byte.
+static void headerByte(HttpConnection* connection, uint8_t c) {
+  HttpResponse* response = &connection->response;
+  if (c != '\n') {
+    if (c != '\r' && response->line_len < kHeaderLineMax - 1) {
+      response->line[response->line_len++] = tolower(c);
+    }
+    return;
+  }
+  char* line = response->line;
+  line[response->line_len] = '\0';
+  if (response->status_code == 0) {
+    // HTTP/1.1 200 OK
+    const char* code = strchr(line, ' ');
+    response->status_code = code ? atoi(code + 1) : -1;
+  } else if (response->line_len == 0) {
+    response->headers_done = true;
+    if (response->chunked) {
+      response->remaining = 0;
+    } else if (response->remaining < 0) {
+      // Without a length the body runs until the server hangs up.
+      connection->closing = true;
+    }
+    response->finished = !response->chunked && response->remaining == 0;
+  } else if (headerIs(line, "content-length", NULL)) {
+    response->remaining = atol(line + strlen("content-length:"));
+  } else if (headerIs(line, "transfer-encoding", "chunked")) {
+    response->chunked = true;
+  } else if (headerIs(line, "connection", "close")) {
+    connection->closing = true;
+  }
+  response->line_len = 0;
+}
+
+static int hexDigit(uint8_t c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// Steps the chunk framing over one byte. Returns true if c is body data.
+static bool chunkFraming(HttpResponse* response, uint8_t c) {
+  switch (response->chunk_state) {
+  case kChunkSize: {
+    int digit = hexDigit(c);
+    if (digit >= 0) {
+      response->remaining = response->remaining * 16 + digit;
+    } else if (c == ';') {
+      response->chunk_state = kChunkExtension;
+    } else if (c == '\n') {
+      response->chunk_state = response->remaining ? kChunkData : kChunkTrailer;
+    }
+    return false;
+  }
+  case kChunkExtension:
+    if (c == '\n') {
+      response->chunk_state = response->remaining ? kChunkData : kChunkTrailer;
+    }
+    return false;
+  case kChunkData:
+    if (--response->remaining == 0) {
+      response->chunk_state = kChunkDataEnd;
+    }
+    return true;
+  case kChunkDataEnd:
+    if (c == '\n') {
+      response->chunk_state = kChunkSize;
+    }
+    return false;
+  default:
+    // Trailer lines, up to the blank line that ends the response.
+    if (c == '\n') {
+      if (response->remaining == 0) {
+        response->finished = true;
+      }
+      response->remaining = 0;
+    } else if (c != '\r') {
+      response->remaining = 1;
+    }
+    return false;
+  }
+}
+
+int httpPoll(HttpConnection* connection, uint8_t* buf, int size) {
+  HttpResponse* response = &connection->response;
+  int count = 0;
+  if (connection->pending == 0) {
+    return 0;
+  }
+  pull(connection);
+  while (connection->ring_count > 0 && count < size && !response->finished) {
+    uint8_t c = connection->ring[connection->ring_start];
+    connection->ring_start = (connection->ring_start + 1) % kHttpRingSize;
+    connection->ring_count--;
+    response->started = true;
+    if (!response->headers_done) {
+      headerByte(connection, c);
+    } else if (response->chunked) {
+      if (chunkFraming(response, c)) {
+        buf[count++] = c;
+      }
+    } else {
+      buf[count++] = c;
+      if (response->remaining > 0 && --response->remaining == 0) {
+        response->finished = true;
+      }
+    }
+    if (connection->ring_count == 0) {
+      pull(connection);
+    }
+  }
+
+  if (count == 0 && !response->finished && connection->ring_count == 0 &&
+      !connection->client->connected()) {
+    if (response->headers_done && !response->chunked && response->remaining < 0) {
+      // A body with no length ends when the server closes the connection.
+      response->finished = true;
+      return 0;
+    }
+    bool lost = !response->started;
+    httpStop(connection);
+    return lost ? kConnectionLost : kBodyTruncated;
+  }
+  return count;
+}
@@ -0,0 +1,84 @@
+#ifndef http_connection_h
+#define http_connection_h
+
+#include <Client.h>
+
+const int kHttpRingSize = 128;
+const int kHeaderLineMax = 32;
+// Most requests sent ahead of their responses.
+const int kMaxPipelined = 4;
+
+// Returned by httpPoll() when the connection closes part way through a
+// response.
+const int kBodyTruncated = -7;
+// Returned by httpPoll() when the server had closed the connection before
+// sending anything of the response. The request can be sent again as it is.
+const int kConnectionLost = -8;
+
+// The response at the head of an HttpConnection, decoded as its bytes
+// arrive. Bodies sized by Content-Length, sent with chunked transfer encoding
+// or ended by the server closing the connection are all handled.
+struct HttpResponse {
+  // 0 until the status line has been read.
+  int status_code;
+  bool headers_done;
+  bool chunked;
+  // Bytes left in the body, or in the current chunk. -1 if not known.
+  long remaining;
+  int chunk_state;
+  bool finished;
+  // Some of the response has arrived.
+  bool started;
+
+  char line[kHeaderLineMax];
+  int line_len;
+};
+
+// One HTTP/1.1 keep-alive connection to a host. Requests can be sent ahead
+// of reading the responses, which then come back in order. The connection is
+// made on the first request and again on the next one if the server has
+// closed it, so a whole cycle of queries normally costs one TLS handshake.
+//
+// Nothing here waits for the network. httpPoll() moves whatever the socket
+// has into a small ring buffer in one read and decodes as much of it as it
+// can, so the caller can service several connections in one loop.
+struct HttpConnection {
+  Client* client;
+  const char* host;
+  int port;
+
+  uint8_t ring[kHttpRingSize];
+  int ring_start;
+  int ring_count;
+
+  // Requests sent whose responses haven't been read yet.
+  int pending;
+  // The last response said the server closes the connection after it.
+  bool closing;
+  HttpResponse response;
+
+  // Stats for the log
+  int handshakes;
+  unsigned long bytes_received;
+};
+
+void httpBegin(HttpConnection* connection, Client* client, const char* host, int port);
+
+// Sends a GET for path, connecting first if need be. Returns 0, or a
+// negative error with the connection closed.
+int httpSendGet(HttpConnection* connection, const char* path);
+
+// Decodes what has arrived of the head response, copying up to size bytes
+// of its body into buf. Returns the number of body bytes, which may be 0,
+// kConnectionLost or kBodyTruncated. In either error case the connection
+// has been closed and the requests pending on it are forgotten.
+// connection->response says how far the response has got.
+int httpPoll(HttpConnection* connection, uint8_t* buf, int size);
+
+// Moves on to the next pending response once the head one is finished.
+void httpNextResponse(HttpConnection* connection);
+
+// Closes the connection. Requests still pending are forgotten.
+void httpStop(HttpConnection* connection);
+
+#endif
@@ -1,1062 +1,543 @@
+// Generated by tools/glyphc from glyphs/glyphs.txt, do not edit.
+//
+// Glyphs sit in a DIGIT_HEIGHT tall cell whose bottom edge is the line's
+// baseline y. Only the rows from GLYPH_TOP to GLYPH_TOP + GLYPH_HEIGHT that hold
+// ink are stored, each GLYPH_BYTE_WIDTH bytes wide. A glyph's rows are one
+// PackBits stream starting at GLYPH_ATLAS[GLYPH_OFFSET[id]]: a control byte
+// n < 128 is followed by n + 1 literal bytes, n > 128 repeats the next byte
+// 257 - n times.
+
+#ifndef imagedata_h
+#define imagedata_h
+
 #include <avr/pgmspace.h>
-const int DIGIT_HEIGHT = 60;
-struct Element {int byte_width; int advance; const unsigned char* data;};
 
-const int DIGIT_0_BYTE_WIDTH = 4;
-const int DIGIT_0_ADVANCE = 35;
-const unsigned char DIGIT_0_DATA[240] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf8,0x00,
-0x00,0x3f,0xff,0x00,0x00,0x7f,0xff,0xc0,0x00,0xff,0xff,0xe0,0x01,0xff,0xff,0xf0,
-0x03,0xff,0xff,0xf8,0x07,0xff,0xff,0xf8,0x07,0xfe,0x1f,0xfc,0x0f,0xfc,0x07,0xfc,
-0x0f,0xf8,0x07,0xfe,0x0f,0xf8,0x03,0xfe,0x1f,0xf8,0x03,0xfe,0x1f,0xf0,0x03,0xfe,
-0x1f,0xf0,0x03,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,
-0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,
-0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,
-0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,
-0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x03,0xff,0x1f,0xf8,0x03,0xfe,0x0f,0xf8,0x03,0xfe,
-0x0f,0xf8,0x03,0xfe,0x0f,0xfc,0x07,0xfc,0x07,0xfe,0x0f,0xfc,0x07,0xff,0xff,0xfc,
-0x03,0xff,0xff,0xf8,0x03,0xff,0xff,0xf0,0x01,0xff,0xff,0xe0,0x00,0xff,0xff,0xc0,
-0x00,0x3f,0xff,0x80,0x00,0x0f,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+typedef uint8_t Glyph;
+
+const int DIGIT_HEIGHT = 60;
+const int GLYPH_COUNT = 41;
+
+const Glyph DIGIT_0 = 0;
+const Glyph DIGIT_1 = 1;
+const Glyph DIGIT_2 = 2;
+const Glyph DIGIT_3 = 3;
+const Glyph DIGIT_4 = 4;
+const Glyph DIGIT_5 = 5;
+const Glyph DIGIT_6 = 6;
+const Glyph DIGIT_7 = 7;
+const Glyph DIGIT_8 = 8;
+const Glyph DIGIT_9 = 9;
+const Glyph DIGIT_LIGHT_0 = 10;
+const Glyph DIGIT_LIGHT_1 = 11;
+const Glyph DIGIT_LIGHT_2 = 12;
+const Glyph DIGIT_LIGHT_3 = 13;
+const Glyph DIGIT_LIGHT_4 = 14;
+const Glyph DIGIT_LIGHT_5 = 15;
+const Glyph DIGIT_LIGHT_6 = 16;
+const Glyph DIGIT_LIGHT_7 = 17;
+const Glyph DIGIT_LIGHT_8 = 18;
+const Glyph DIGIT_LIGHT_9 = 19;
+const Glyph DIGIT_SMALL_0 = 20;
+const Glyph DIGIT_SMALL_1 = 21;
+const Glyph DIGIT_SMALL_2 = 22;
+const Glyph DIGIT_SMALL_3 = 23;
+const Glyph DIGIT_SMALL_4 = 24;
+const Glyph DIGIT_SMALL_5 = 25;
+const Glyph DIGIT_SMALL_6 = 26;
+const Glyph DIGIT_SMALL_7 = 27;
+const Glyph DIGIT_SMALL_8 = 28;
+const Glyph DIGIT_SMALL_9 = 29;
+const Glyph MINS = 30;
+const Glyph SEP = 31;
+const Glyph COLON = 32;
+const Glyph COLON_LIGHT = 33;
+const Glyph COLON_SMALL = 34;
+const Glyph STATUS = 35;
+const Glyph BATT = 36;
+const Glyph PERCENT = 37;
+const Glyph STUGAN = 38;
+const Glyph TORGET = 39;
+const Glyph SKOLAN = 40;
+
+const Glyph DIGITS[] = {DIGIT_0, DIGIT_1, DIGIT_2, DIGIT_3, DIGIT_4, DIGIT_5, DIGIT_6, DIGIT_7, DIGIT_8, DIGIT_9};
+const Glyph DIGITS_LIGHT[] = {DIGIT_LIGHT_0, DIGIT_LIGHT_1, DIGIT_LIGHT_2, DIGIT_LIGHT_3, DIGIT_LIGHT_4, DIGIT_LIGHT_5, DIGIT_LIGHT_6, DIGIT_LIGHT_7, DIGIT_LIGHT_8, DIGIT_LIGHT_9};
+const Glyph DIGITS_SMALL[] = {DIGIT_SMALL_0, DIGIT_SMALL_1, DIGIT_SMALL_2, DIGIT_SMALL_3, DIGIT_SMALL_4, DIGIT_SMALL_5, DIGIT_SMALL_6, DIGIT_SMALL_7, DIGIT_SMALL_8, DIGIT_SMALL_9};
+
+const uint8_t GLYPH_BYTE_WIDTH[GLYPH_COUNT] PROGMEM = {
+4,3,4,4,5,4,5,4,4,4,4,3,4,4,4,4,
+4,4,4,4,2,2,2,2,2,2,2,2,2,2,9,2,
+2,1,1,12,8,3,23,22,22
+};
+const uint8_t GLYPH_ADVANCE[GLYPH_COUNT] PROGMEM = {
+35,35,35,35,35,35,35,35,35,35,34,34,34,34,34,34,
+34,34,34,34,18,18,18,18,18,18,18,18,18,18,67,18,
+19,13,10,105,73,23,187,174,178
+};
+const uint8_t GLYPH_TOP[GLYPH_COUNT] PROGMEM = {
+3,4,3,3,4,4,3,4,3,3,3,4,3,3,4,4,
+3,4,3,3,25,25,25,25,25,25,25,25,25,25,24,30,
+14,15,30,25,25,25,3,4,1
+};
+const uint8_t GLYPH_HEIGHT[GLYPH_COUNT] PROGMEM = {
+43,42,43,43,42,42,43,42,43,43,43,42,43,43,42,42,
+43,42,43,43,21,21,21,21,21,21,21,21,21,21,22,1,
+32,31,16,21,21,21,55,54,45
+};
+const uint16_t GLYPH_OFFSET[GLYPH_COUNT] PROGMEM = {
+0,174,301,474,648,859,1029,1246,1416,1590,1763,1937,2064,2237,2410,2579,
+2748,2921,3090,3264,3437,3480,3523,3566,3609,3650,3693,3736,3779,3822,3865,4028,
+4031,4071,4079,4089,4327,4494,4558,5446,6291
 };
-Element DIGIT_0{DIGIT_0_BYTE_WIDTH, DIGIT_0_ADVANCE, DIGIT_0_DATA};
 
-const int DIGIT_1_BYTE_WIDTH = 3;
-const int DIGIT_1_ADVANCE = 35;
-const unsigned char DIGIT_1_DATA[180] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,
-0x00,0x3f,0x00,0x01,0xff,0x00,0x0f,0xff,0x00,0x7f,0xff,0x01,0xff,0xff,0x07,0xff,
-0xff,0x07,0xff,0xff,0x07,0xff,0xff,0x07,0xff,0xff,0x07,0xf9,0xff,0x07,0xc1,0xff,
-0x06,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,
+const unsigned char GLYPH_ATLAS[7153] PROGMEM = {
+0x7f,0x00,0x07,0xf8,0x00,0x00,0x3f,0xff,0x00,0x00,0x7f,0xff,0xc0,0x00,0xff,0xff,
+0xe0,0x01,0xff,0xff,0xf0,0x03,0xff,0xff,0xf8,0x07,0xff,0xff,0xf8,0x07,0xfe,0x1f,
+0xfc,0x0f,0xfc,0x07,0xfc,0x0f,0xf8,0x07,0xfe,0x0f,0xf8,0x03,0xfe,0x1f,0xf8,0x03,
+0xfe,0x1f,0xf0,0x03,0xfe,0x1f,0xf0,0x03,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,
+0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,
+0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,
+0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,
+0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x03,0xff,0x1f,0xf8,0x03,
+0xfe,0x2b,0x0f,0xf8,0x03,0xfe,0x0f,0xf8,0x03,0xfe,0x0f,0xfc,0x07,0xfc,0x07,0xfe,
+0x0f,0xfc,0x07,0xff,0xff,0xfc,0x03,0xff,0xff,0xf8,0x03,0xff,0xff,0xf0,0x01,0xff,
+0xff,0xe0,0x00,0xff,0xff,0xc0,0x00,0x3f,0xff,0x80,0x00,0x0f,0xfe,0x00,0x7d,0x00,
+0x00,0x07,0x00,0x00,0x3f,0x00,0x01,0xff,0x00,0x0f,0xff,0x00,0x7f,0xff,0x01,0xff,
+0xff,0x07,0xff,0xff,0x07,0xff,0xff,0x07,0xff,0xff,0x07,0xff,0xff,0x07,0xf9,0xff,
+0x07,0xc1,0xff,0x06,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,
 0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,
 0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,
 0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,
 0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,
-0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00};
-Element DIGIT_1{DIGIT_1_BYTE_WIDTH, DIGIT_1_ADVANCE, DIGIT_1_DATA};
-
-const int DIGIT_2_BYTE_WIDTH = 5;
-const int DIGIT_2_ADVANCE = 35;
-const unsigned char DIGIT_2_DATA[300] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x07,0xfc,0x00,0x00,0x00,0x3f,0xff,0x80,0x00,0x00,0xff,0xff,0xe0,0x00,0x01,0xff,
-0xff,0xf0,0x00,0x03,0xff,0xff,0xf8,0x00,0x07,0xff,0xff,0xf8,0x00,0x0f,0xff,0xff,
-0xfc,0x00,0x0f,0xfe,0x1f,0xfc,0x00,0x1f,0xf8,0x0f,0xfe,0x00,0x1f,0xf8,0x07,0xfe,
-0x00,0x3f,0xf0,0x07,0xfe,0x00,0x3f,0xf0,0x03,0xfe,0x00,0x3f,0xe0,0x03,0xfe,0x00,
-0x3f,0xe0,0x03,0xfe,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,
-0x00,0x07,0xfc,0x00,0x00,0x00,0x0f,0xfc,0x00,0x00,0x00,0x1f,0xf8,0x00,0x00,0x00,
-0x1f,0xf8,0x00,0x00,0x00,0x3f,0xf0,0x00,0x00,0x00,0x7f,0xf0,0x00,0x00,0x00,0xff,
-0xe0,0x00,0x00,0x01,0xff,0xc0,0x00,0x00,0x03,0xff,0x80,0x00,0x00,0x07,0xff,0x00,
-0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x0f,0xfc,0x00,0x00,0x00,0x1f,0xf8,0x00,0x00,
-0x00,0x3f,0xf0,0x00,0x00,0x00,0x7f,0xe0,0x00,0x00,0x00,0xff,0xe0,0x00,0x00,0x01,
-0xff,0xc0,0x00,0x00,0x03,0xff,0x80,0x00,0x00,0x07,0xff,0x00,0x00,0x00,0x0f,0xff,
-0x00,0x00,0x00,0x1f,0xff,0xff,0xff,0x00,0x1f,0xff,0xff,0xff,0x00,0x1f,0xff,0xff,
-0xff,0x00,0x1f,0xff,0xff,0xff,0x00,0x1f,0xff,0xff,0xff,0x00,0x1f,0xff,0xff,0xff,
-0x00,0x1f,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-Element DIGIT_2{DIGIT_2_BYTE_WIDTH, DIGIT_2_ADVANCE, DIGIT_2_DATA};
-
-const int DIGIT_3_BYTE_WIDTH = 5;
-const int DIGIT_3_ADVANCE = 35;
-const unsigned char DIGIT_3_DATA[300] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x0f,0xf8,0x00,0x00,0x00,0x7f,0xff,0x80,0x00,0x01,0xff,0xff,0xc0,0x00,0x03,0xff,
-0xff,0xf0,0x00,0x07,0xff,0xff,0xf8,0x00,0x0f,0xff,0xff,0xfc,0x00,0x1f,0xff,0xff,
-0xfc,0x00,0x1f,0xfe,0x1f,0xfe,0x00,0x1f,0xf8,0x07,0xfe,0x00,0x3f,0xf0,0x07,0xfe,
-0x00,0x3f,0xf0,0x03,0xfe,0x00,0x00,0x00,0x03,0xfe,0x00,0x00,0x00,0x03,0xfe,0x00,
-0x00,0x00,0x03,0xfe,0x00,0x00,0x00,0x03,0xfe,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,
-0x00,0x0f,0xfc,0x00,0x00,0x00,0x1f,0xf8,0x00,0x00,0x0f,0xff,0xf0,0x00,0x00,0x0f,
-0xff,0xe0,0x00,0x00,0x0f,0xff,0xc0,0x00,0x00,0x0f,0xff,0x80,0x00,0x00,0x0f,0xff,
-0xe0,0x00,0x00,0x0f,0xff,0xf8,0x00,0x00,0x0f,0xff,0xfc,0x00,0x00,0x00,0x0f,0xfe,
-0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x03,0xff,0x00,0x00,0x00,0x03,0xff,0x00,
-0x00,0x00,0x01,0xff,0x00,0x00,0x00,0x01,0xff,0x00,0x3f,0xe0,0x01,0xff,0x00,0x3f,
-0xe0,0x03,0xff,0x00,0x3f,0xf0,0x03,0xff,0x00,0x3f,0xf8,0x07,0xff,0x00,0x3f,0xfc,
-0x0f,0xfe,0x00,0x1f,0xff,0xff,0xfe,0x00,0x1f,0xff,0xff,0xfc,0x00,0x0f,0xff,0xff,
-0xf8,0x00,0x07,0xff,0xff,0xf0,0x00,0x01,0xff,0xff,0xe0,0x00,0x00,0xff,0xff,0x80,
-0x00,0x00,0x1f,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-Element DIGIT_3{DIGIT_3_BYTE_WIDTH, DIGIT_3_ADVANCE, DIGIT_3_DATA};
-
-const int DIGIT_4_BYTE_WIDTH = 5;
-const int DIGIT_4_ADVANCE = 35;
-const unsigned char DIGIT_4_DATA[300] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf0,0x00,0x00,0x00,0x3f,0xf0,0x00,0x00,0x00,
-0x7f,0xf0,0x00,0x00,0x00,0x7f,0xf0,0x00,0x00,0x00,0xff,0xf0,0x00,0x00,0x01,0xff,
-0xf0,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x03,0xff,0xf0,0x00,0x00,0x07,0xff,0xf0,
-0x00,0x00,0x07,0xff,0xf0,0x00,0x00,0x0f,0xff,0xf0,0x00,0x00,0x0f,0xff,0xf0,0x00,
-0x00,0x1f,0xff,0xf0,0x00,0x00,0x3f,0xdf,0xf0,0x00,0x00,0x3f,0x9f,0xf0,0x00,0x00,
-0x7f,0x9f,0xf0,0x00,0x00,0xff,0x1f,0xf0,0x00,0x00,0xfe,0x1f,0xf0,0x00,0x01,0xfe,
-0x1f,0xf0,0x00,0x01,0xfc,0x1f,0xf0,0x00,0x03,0xfc,0x1f,0xf0,0x00,0x07,0xf8,0x1f,
-0xf0,0x00,0x07,0xf0,0x1f,0xf0,0x00,0x0f,0xf0,0x1f,0xf0,0x00,0x0f,0xe0,0x1f,0xf0,
-0x00,0x1f,0xe0,0x1f,0xf8,0x00,0x3f,0xff,0xff,0xff,0x80,0x3f,0xff,0xff,0xff,0x80,
-0x3f,0xff,0xff,0xff,0x80,0x3f,0xff,0xff,0xff,0x80,0x3f,0xff,0xff,0xff,0x80,0x3f,
-0xff,0xff,0xff,0x80,0x1f,0xff,0xff,0xff,0x80,0x00,0x00,0x1f,0xf0,0x00,0x00,0x00,
-0x1f,0xf0,0x00,0x00,0x00,0x1f,0xf0,0x00,0x00,0x00,0x1f,0xf0,0x00,0x00,0x00,0x1f,
-0xf0,0x00,0x00,0x00,0x1f,0xf0,0x00,0x00,0x00,0x1f,0xf0,0x00,0x00,0x00,0x1f,0xf0,
-0x00,0x00,0x00,0x1f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-Element DIGIT_4{DIGIT_4_BYTE_WIDTH, DIGIT_4_ADVANCE, DIGIT_4_DATA};
-
-const int DIGIT_5_BYTE_WIDTH = 4;
-const int DIGIT_5_ADVANCE = 35;
-const unsigned char DIGIT_5_DATA[240] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x03,0xff,0xff,0xfc,0x03,0xff,0xff,0xfc,0x03,0xff,0xff,0xfc,0x03,0xff,0xff,0xfc,
-0x07,0xff,0xff,0xfc,0x07,0xff,0xff,0xfc,0x07,0xff,0xff,0xfc,0x07,0xf8,0x00,0x00,
+0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x7f,0x00,0x07,
+0xfc,0x00,0x00,0x3f,0xff,0x80,0x00,0xff,0xff,0xe0,0x01,0xff,0xff,0xf0,0x03,0xff,
+0xff,0xf8,0x07,0xff,0xff,0xf8,0x0f,0xff,0xff,0xfc,0x0f,0xfe,0x1f,0xfc,0x1f,0xf8,
+0x0f,0xfe,0x1f,0xf8,0x07,0xfe,0x3f,0xf0,0x07,0xfe,0x3f,0xf0,0x03,0xfe,0x3f,0xe0,
+0x03,0xfe,0x3f,0xe0,0x03,0xfe,0x00,0x00,0x07,0xfe,0x00,0x00,0x07,0xfe,0x00,0x00,
+0x07,0xfc,0x00,0x00,0x0f,0xfc,0x00,0x00,0x1f,0xf8,0x00,0x00,0x1f,0xf8,0x00,0x00,
+0x3f,0xf0,0x00,0x00,0x7f,0xf0,0x00,0x00,0xff,0xe0,0x00,0x01,0xff,0xc0,0x00,0x03,
+0xff,0x80,0x00,0x07,0xff,0x00,0x00,0x07,0xfe,0x00,0x00,0x0f,0xfc,0x00,0x00,0x1f,
+0xf8,0x00,0x00,0x3f,0xf0,0x00,0x00,0x7f,0xe0,0x00,0x00,0xff,0xe0,0x00,0x10,0x01,
+0xff,0xc0,0x00,0x03,0xff,0x80,0x00,0x07,0xff,0x00,0x00,0x0f,0xff,0x00,0x00,0x1f,
+0xfe,0xff,0x00,0x1f,0xfe,0xff,0x00,0x1f,0xfe,0xff,0x00,0x1f,0xfe,0xff,0x00,0x1f,
+0xfe,0xff,0x00,0x1f,0xfe,0xff,0x00,0x1f,0xfe,0xff,0x7f,0x00,0x0f,0xf8,0x00,0x00,
+0x7f,0xff,0x80,0x01,0xff,0xff,0xc0,0x03,0xff,0xff,0xf0,0x07,0xff,0xff,0xf8,0x0f,
+0xff,0xff,0xfc,0x1f,0xff,0xff,0xfc,0x1f,0xfe,0x1f,0xfe,0x1f,0xf8,0x07,0xfe,0x3f,
+0xf0,0x07,0xfe,0x3f,0xf0,0x03,0xfe,0x00,0x00,0x03,0xfe,0x00,0x00,0x03,0xfe,0x00,
+0x00,0x03,0xfe,0x00,0x00,0x03,0xfe,0x00,0x00,0x07,0xfe,0x00,0x00,0x0f,0xfc,0x00,
+0x00,0x1f,0xf8,0x00,0x0f,0xff,0xf0,0x00,0x0f,0xff,0xe0,0x00,0x0f,0xff,0xc0,0x00,
+0x0f,0xff,0x80,0x00,0x0f,0xff,0xe0,0x00,0x0f,0xff,0xf8,0x00,0x0f,0xff,0xfc,0x00,
+0x00,0x0f,0xfe,0x00,0x00,0x07,0xfe,0x00,0x00,0x03,0xff,0x00,0x00,0x03,0xff,0x00,
+0x00,0x01,0xff,0x00,0x00,0x01,0xff,0x3f,0xe0,0x01,0xff,0x2b,0x3f,0xe0,0x03,0xff,
+0x3f,0xf0,0x03,0xff,0x3f,0xf8,0x07,0xff,0x3f,0xfc,0x0f,0xfe,0x1f,0xff,0xff,0xfe,
+0x1f,0xff,0xff,0xfc,0x0f,0xff,0xff,0xf8,0x07,0xff,0xff,0xf0,0x01,0xff,0xff,0xe0,
+0x00,0xff,0xff,0x80,0x00,0x1f,0xfe,0x00,0x03,0x00,0x00,0x3f,0xf0,0xfe,0x00,0x01,
+0x3f,0xf0,0xfe,0x00,0x01,0x7f,0xf0,0xfe,0x00,0x01,0x7f,0xf0,0xfe,0x00,0x6c,0xff,
+0xf0,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x03,0xff,0xf0,
+0x00,0x00,0x07,0xff,0xf0,0x00,0x00,0x07,0xff,0xf0,0x00,0x00,0x0f,0xff,0xf0,0x00,
+0x00,0x0f,0xff,0xf0,0x00,0x00,0x1f,0xff,0xf0,0x00,0x00,0x3f,0xdf,0xf0,0x00,0x00,
+0x3f,0x9f,0xf0,0x00,0x00,0x7f,0x9f,0xf0,0x00,0x00,0xff,0x1f,0xf0,0x00,0x00,0xfe,
+0x1f,0xf0,0x00,0x01,0xfe,0x1f,0xf0,0x00,0x01,0xfc,0x1f,0xf0,0x00,0x03,0xfc,0x1f,
+0xf0,0x00,0x07,0xf8,0x1f,0xf0,0x00,0x07,0xf0,0x1f,0xf0,0x00,0x0f,0xf0,0x1f,0xf0,
+0x00,0x0f,0xe0,0x1f,0xf0,0x00,0x1f,0xe0,0x1f,0xf8,0x00,0x3f,0xfe,0xff,0x01,0x80,
+0x3f,0xfe,0xff,0x01,0x80,0x3f,0xfe,0xff,0x01,0x80,0x3f,0xfe,0xff,0x01,0x80,0x3f,
+0xfe,0xff,0x01,0x80,0x3f,0xfe,0xff,0x01,0x80,0x1f,0xfe,0xff,0x04,0x80,0x00,0x00,
+0x1f,0xf0,0xfe,0x00,0x01,0x1f,0xf0,0xfe,0x00,0x01,0x1f,0xf0,0xfe,0x00,0x01,0x1f,
+0xf0,0xfe,0x00,0x01,0x1f,0xf0,0xfe,0x00,0x01,0x1f,0xf0,0xfe,0x00,0x01,0x1f,0xf0,
+0xfe,0x00,0x01,0x1f,0xf0,0xfe,0x00,0x02,0x1f,0xf0,0x00,0x7f,0x03,0xff,0xff,0xfc,
+0x03,0xff,0xff,0xfc,0x03,0xff,0xff,0xfc,0x03,0xff,0xff,0xfc,0x07,0xff,0xff,0xfc,
+0x07,0xff,0xff,0xfc,0x07,0xff,0xff,0xfc,0x07,0xf8,0x00,0x00,0x07,0xf8,0x00,0x00,
 0x07,0xf8,0x00,0x00,0x07,0xf8,0x00,0x00,0x07,0xf8,0x00,0x00,0x07,0xf8,0x00,0x00,
-0x07,0xf8,0x00,0x00,0x0f,0xf8,0x00,0x00,0x0f,0xf8,0xfc,0x00,0x0f,0xff,0xff,0x80,
-0x0f,0xff,0xff,0xe0,0x0f,0xff,0xff,0xf0,0x0f,0xff,0xff,0xf8,0x0f,0xff,0xff,0xfc,
-0x0f,0xff,0xff,0xfc,0x03,0xf0,0x0f,0xfe,0x00,0x20,0x07,0xfe,0x00,0x00,0x03,0xfe,
-0x00,0x00,0x03,0xff,0x00,0x00,0x03,0xff,0x00,0x00,0x01,0xff,0x00,0x00,0x01,0xff,
-0x00,0x00,0x01,0xff,0x00,0x00,0x03,0xff,0x1f,0xf0,0x03,0xff,0x1f,0xf0,0x03,0xff,
-0x1f,0xf8,0x03,0xfe,0x1f,0xf8,0x07,0xfe,0x0f,0xfe,0x0f,0xfe,0x0f,0xff,0xff,0xfc,
-0x07,0xff,0xff,0xf8,0x03,0xff,0xff,0xf8,0x01,0xff,0xff,0xf0,0x00,0xff,0xff,0xe0,
-0x00,0x3f,0xff,0x80,0x00,0x0f,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-Element DIGIT_5{DIGIT_5_BYTE_WIDTH, DIGIT_5_ADVANCE, DIGIT_5_DATA};
-
-const int DIGIT_6_BYTE_WIDTH = 5;
-const int DIGIT_6_ADVANCE = 35;
-const unsigned char DIGIT_6_DATA[300] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x0f,0xc0,0x00,0x00,0x00,0x7f,0xc0,0x00,0x00,0x03,0xff,0xc0,0x00,0x00,0x07,
-0xff,0xc0,0x00,0x00,0x1f,0xff,0xc0,0x00,0x00,0x3f,0xff,0xc0,0x00,0x00,0x7f,0xff,
-0xc0,0x00,0x00,0xff,0xfe,0x00,0x00,0x01,0xff,0xe0,0x00,0x00,0x03,0xff,0x80,0x00,
-0x00,0x03,0xff,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x07,0xfc,0x00,0x00,0x00,
-0x0f,0xfc,0x00,0x00,0x00,0x0f,0xf8,0x00,0x00,0x00,0x0f,0xf8,0xff,0xc0,0x00,0x1f,
-0xfb,0xff,0xf0,0x00,0x1f,0xff,0xff,0xf8,0x00,0x1f,0xff,0xff,0xfc,0x00,0x1f,0xff,
-0xff,0xfc,0x00,0x1f,0xff,0xff,0xfe,0x00,0x1f,0xff,0xff,0xfe,0x00,0x1f,0xfc,0x07,
-0xff,0x00,0x1f,0xf8,0x03,0xff,0x00,0x1f,0xf0,0x03,0xff,0x00,0x1f,0xf0,0x01,0xff,
-0x80,0x1f,0xf0,0x01,0xff,0x80,0x1f,0xf0,0x01,0xff,0x80,0x1f,0xf0,0x01,0xff,0x80,
-0x1f,0xf0,0x01,0xff,0x80,0x1f,0xf0,0x01,0xff,0x80,0x1f,0xf0,0x01,0xff,0x80,0x0f,
-0xf8,0x01,0xff,0x00,0x0f,0xf8,0x03,0xff,0x00,0x0f,0xfc,0x07,0xff,0x00,0x07,0xfe,
-0x0f,0xfe,0x00,0x07,0xff,0xff,0xfe,0x00,0x03,0xff,0xff,0xfc,0x00,0x01,0xff,0xff,
-0xf8,0x00,0x00,0xff,0xff,0xf0,0x00,0x00,0x7f,0xff,0xe0,0x00,0x00,0x1f,0xff,0xc0,
-0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-Element DIGIT_6{DIGIT_6_BYTE_WIDTH, DIGIT_6_ADVANCE, DIGIT_6_DATA};
-
-const int DIGIT_7_BYTE_WIDTH = 5;
-const int DIGIT_7_ADVANCE = 35;
-const unsigned char DIGIT_7_DATA[300] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0xff,0x00,0x3f,0xff,0xff,0xff,0x00,0x3f,0xff,
-0xff,0xff,0x00,0x3f,0xff,0xff,0xff,0x00,0x3f,0xff,0xff,0xff,0x00,0x3f,0xff,0xff,
-0xff,0x00,0x3f,0xff,0xff,0xfe,0x00,0x00,0x00,0x03,0xfe,0x00,0x00,0x00,0x07,0xfc,
-0x00,0x00,0x00,0x07,0xfc,0x00,0x00,0x00,0x07,0xf8,0x00,0x00,0x00,0x0f,0xf8,0x00,
-0x00,0x00,0x0f,0xf8,0x00,0x00,0x00,0x1f,0xf0,0x00,0x00,0x00,0x1f,0xf0,0x00,0x00,
-0x00,0x3f,0xe0,0x00,0x00,0x00,0x3f,0xe0,0x00,0x00,0x00,0x7f,0xc0,0x00,0x00,0x00,
-0x7f,0xc0,0x00,0x00,0x00,0xff,0xc0,0x00,0x00,0x00,0xff,0x80,0x00,0x00,0x00,0xff,
-0x80,0x00,0x00,0x01,0xff,0x00,0x00,0x00,0x01,0xff,0x00,0x00,0x00,0x03,0xfe,0x00,
-0x00,0x00,0x03,0xfe,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x07,0xfc,0x00,0x00,
-0x00,0x0f,0xfc,0x00,0x00,0x00,0x0f,0xf8,0x00,0x00,0x00,0x1f,0xf8,0x00,0x00,0x00,
-0x1f,0xf0,0x00,0x00,0x00,0x3f,0xf0,0x00,0x00,0x00,0x3f,0xf0,0x00,0x00,0x00,0x3f,
-0xe0,0x00,0x00,0x00,0x7f,0xe0,0x00,0x00,0x00,0x7f,0xc0,0x00,0x00,0x00,0xff,0xc0,
-0x00,0x00,0x00,0xff,0xc0,0x00,0x00,0x01,0xff,0x80,0x00,0x00,0x01,0xff,0x80,0x00,
-0x00,0x03,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-Element DIGIT_7{DIGIT_7_BYTE_WIDTH, DIGIT_7_ADVANCE, DIGIT_7_DATA};
-
-const int DIGIT_8_BYTE_WIDTH = 4;
-const int DIGIT_8_ADVANCE = 35;
-const unsigned char DIGIT_8_DATA[240] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfc,0x00,
-0x00,0x3f,0xff,0x80,0x00,0xff,0xff,0xe0,0x01,0xff,0xff,0xf0,0x03,0xff,0xff,0xf8,
-0x07,0xff,0xff,0xf8,0x07,0xff,0xff,0xfc,0x0f,0xfe,0x1f,0xfc,0x0f,0xfc,0x07,0xfe,
-0x0f,0xfc,0x07,0xfe,0x0f,0xf8,0x03,0xfe,0x0f,0xf8,0x03,0xfe,0x0f,0xf8,0x03,0xfe,
-0x0f,0xf8,0x03,0xfe,0x0f,0xf8,0x07,0xfe,0x0f,0xfc,0x07,0xfc,0x07,0xfe,0x0f,0xfc,
-0x07,0xff,0x3f,0xf8,0x03,0xff,0xff,0xf0,0x01,0xff,0xff,0xe0,0x00,0x7f,0xff,0xc0,
-0x00,0x7f,0xff,0xc0,0x01,0xff,0xff,0xf0,0x03,0xff,0xff,0xf8,0x07,0xff,0xff,0xfc,
-0x0f,0xfc,0x0f,0xfc,0x0f,0xf8,0x07,0xfe,0x1f,0xf8,0x03,0xfe,0x1f,0xf0,0x03,0xff,
-0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x03,0xff,
-0x1f,0xf8,0x03,0xff,0x1f,0xf8,0x07,0xff,0x1f,0xfe,0x0f,0xfe,0x0f,0xff,0xff,0xfe,
-0x0f,0xff,0xff,0xfc,0x07,0xff,0xff,0xfc,0x03,0xff,0xff,0xf8,0x01,0xff,0xff,0xf0,
-0x00,0x7f,0xff,0xc0,0x00,0x1f,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-Element DIGIT_8{DIGIT_8_BYTE_WIDTH, DIGIT_8_ADVANCE, DIGIT_8_DATA};
-
-const int DIGIT_9_BYTE_WIDTH = 4;
-const int DIGIT_9_ADVANCE = 35;
-const unsigned char DIGIT_9_DATA[240] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf8,0x00,
-0x00,0x1f,0xff,0x00,0x00,0x7f,0xff,0x80,0x00,0xff,0xff,0xe0,0x01,0xff,0xff,0xf0,
-0x03,0xff,0xff,0xf0,0x07,0xff,0xff,0xf8,0x0f,0xfe,0x1f,0xfc,0x0f,0xfc,0x0f,0xfc,
-0x0f,0xf8,0x07,0xfe,0x1f,0xf8,0x03,0xfe,0x1f,0xf0,0x03,0xfe,0x1f,0xf0,0x03,0xfe,
-0x1f,0xf0,0x03,0xfe,0x1f,0xf0,0x03,0xff,0x1f,0xf0,0x03,0xff,0x1f,0xf0,0x03,0xff,
-0x1f,0xf0,0x03,0xff,0x1f,0xf0,0x03,0xff,0x1f,0xf8,0x03,0xff,0x1f,0xfc,0x03,0xff,
-0x0f,0xfe,0x07,0xff,0x0f,0xff,0xbf,0xff,0x07,0xff,0xff,0xff,0x07,0xff,0xff,0xff,
-0x03,0xff,0xff,0xfe,0x01,0xff,0xff,0xfe,0x00,0x7f,0xf3,0xfe,0x00,0x1f,0xc3,0xfe,
-0x00,0x00,0x03,0xfc,0x00,0x00,0x07,0xfc,0x00,0x00,0x0f,0xfc,0x00,0x00,0x0f,0xf8,
-0x00,0x00,0x3f,0xf8,0x00,0x00,0x7f,0xf0,0x00,0x03,0xff,0xe0,0x00,0x7f,0xff,0xc0,
-0x00,0x7f,0xff,0x80,0x00,0x7f,0xff,0x00,0x00,0x7f,0xfe,0x00,0x00,0x7f,0xf8,0x00,
-0x00,0x7f,0xe0,0x00,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-Element DIGIT_9{DIGIT_9_BYTE_WIDTH, DIGIT_9_ADVANCE, DIGIT_9_DATA};
-
-const Element DIGITS[] = {
-  DIGIT_0, DIGIT_1, DIGIT_2, DIGIT_3, DIGIT_4, DIGIT_5, DIGIT_6, DIGIT_7, DIGIT_8, DIGIT_9
-};const int DIGIT_LIGHT_0_BYTE_WIDTH = 4;
-const int DIGIT_LIGHT_0_ADVANCE = 34;
-const unsigned char DIGIT_LIGHT_0_DATA[240] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,
-0x00,0x3f,0xfe,0x00,0x00,0x7f,0x7f,0x00,0x00,0xf0,0x07,0x80,0x01,0xe0,0x03,0xc0,
-0x03,0xc0,0x01,0xe0,0x03,0x80,0x00,0xe0,0x07,0x80,0x00,0x70,0x07,0x00,0x00,0x70,
-0x07,0x00,0x00,0x70,0x06,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,
+0x0f,0xf8,0x00,0x00,0x0f,0xf8,0xfc,0x00,0x0f,0xff,0xff,0x80,0x0f,0xff,0xff,0xe0,
+0x0f,0xff,0xff,0xf0,0x0f,0xff,0xff,0xf8,0x0f,0xff,0xff,0xfc,0x0f,0xff,0xff,0xfc,
+0x03,0xf0,0x0f,0xfe,0x00,0x20,0x07,0xfe,0x00,0x00,0x03,0xfe,0x00,0x00,0x03,0xff,
+0x00,0x00,0x03,0xff,0x00,0x00,0x01,0xff,0x00,0x00,0x01,0xff,0x00,0x00,0x01,0xff,
+0x00,0x00,0x03,0xff,0x1f,0xf0,0x03,0xff,0x1f,0xf0,0x03,0xff,0x27,0x1f,0xf8,0x03,
+0xfe,0x1f,0xf8,0x07,0xfe,0x0f,0xfe,0x0f,0xfe,0x0f,0xff,0xff,0xfc,0x07,0xff,0xff,
+0xf8,0x03,0xff,0xff,0xf8,0x01,0xff,0xff,0xf0,0x00,0xff,0xff,0xe0,0x00,0x3f,0xff,
+0x80,0x00,0x0f,0xfe,0x00,0x03,0x00,0x00,0x0f,0xc0,0xfe,0x00,0x2c,0x7f,0xc0,0x00,
+0x00,0x03,0xff,0xc0,0x00,0x00,0x07,0xff,0xc0,0x00,0x00,0x1f,0xff,0xc0,0x00,0x00,
+0x3f,0xff,0xc0,0x00,0x00,0x7f,0xff,0xc0,0x00,0x00,0xff,0xfe,0x00,0x00,0x01,0xff,
+0xe0,0x00,0x00,0x03,0xff,0x80,0x00,0x00,0x03,0xff,0xfe,0x00,0x01,0x07,0xfe,0xfe,
+0x00,0x01,0x07,0xfc,0xfe,0x00,0x01,0x0f,0xfc,0xfe,0x00,0x01,0x0f,0xf8,0xfe,0x00,
+0x7f,0x0f,0xf8,0xff,0xc0,0x00,0x1f,0xfb,0xff,0xf0,0x00,0x1f,0xff,0xff,0xf8,0x00,
+0x1f,0xff,0xff,0xfc,0x00,0x1f,0xff,0xff,0xfc,0x00,0x1f,0xff,0xff,0xfe,0x00,0x1f,
+0xff,0xff,0xfe,0x00,0x1f,0xfc,0x07,0xff,0x00,0x1f,0xf8,0x03,0xff,0x00,0x1f,0xf0,
+0x03,0xff,0x00,0x1f,0xf0,0x01,0xff,0x80,0x1f,0xf0,0x01,0xff,0x80,0x1f,0xf0,0x01,
+0xff,0x80,0x1f,0xf0,0x01,0xff,0x80,0x1f,0xf0,0x01,0xff,0x80,0x1f,0xf0,0x01,0xff,
+0x80,0x1f,0xf0,0x01,0xff,0x80,0x0f,0xf8,0x01,0xff,0x00,0x0f,0xf8,0x03,0xff,0x00,
+0x0f,0xfc,0x07,0xff,0x00,0x07,0xfe,0x0f,0xfe,0x00,0x07,0xff,0xff,0xfe,0x00,0x03,
+0xff,0xff,0xfc,0x00,0x01,0xff,0xff,0xf8,0x00,0x00,0xff,0xff,0xf0,0x00,0x00,0x7f,
+0xff,0x0b,0xe0,0x00,0x00,0x1f,0xff,0xc0,0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x3f,
+0xfe,0xff,0x00,0x3f,0xfe,0xff,0x00,0x3f,0xfe,0xff,0x00,0x3f,0xfe,0xff,0x00,0x3f,
+0xfe,0xff,0x00,0x3f,0xfe,0xff,0x7f,0x3f,0xff,0xff,0xfe,0x00,0x00,0x03,0xfe,0x00,
+0x00,0x07,0xfc,0x00,0x00,0x07,0xfc,0x00,0x00,0x07,0xf8,0x00,0x00,0x0f,0xf8,0x00,
+0x00,0x0f,0xf8,0x00,0x00,0x1f,0xf0,0x00,0x00,0x1f,0xf0,0x00,0x00,0x3f,0xe0,0x00,
+0x00,0x3f,0xe0,0x00,0x00,0x7f,0xc0,0x00,0x00,0x7f,0xc0,0x00,0x00,0xff,0xc0,0x00,
+0x00,0xff,0x80,0x00,0x00,0xff,0x80,0x00,0x01,0xff,0x00,0x00,0x01,0xff,0x00,0x00,
+0x03,0xfe,0x00,0x00,0x03,0xfe,0x00,0x00,0x07,0xfe,0x00,0x00,0x07,0xfc,0x00,0x00,
+0x0f,0xfc,0x00,0x00,0x0f,0xf8,0x00,0x00,0x1f,0xf8,0x00,0x00,0x1f,0xf0,0x00,0x00,
+0x3f,0xf0,0x00,0x00,0x3f,0xf0,0x00,0x00,0x3f,0xe0,0x00,0x00,0x7f,0xe0,0x00,0x00,
+0x7f,0xc0,0x00,0x00,0xff,0xc0,0x00,0x0f,0x00,0xff,0xc0,0x00,0x01,0xff,0x80,0x00,
+0x01,0xff,0x80,0x00,0x03,0xff,0x00,0x00,0x7f,0x00,0x07,0xfc,0x00,0x00,0x3f,0xff,
+0x80,0x00,0xff,0xff,0xe0,0x01,0xff,0xff,0xf0,0x03,0xff,0xff,0xf8,0x07,0xff,0xff,
+0xf8,0x07,0xff,0xff,0xfc,0x0f,0xfe,0x1f,0xfc,0x0f,0xfc,0x07,0xfe,0x0f,0xfc,0x07,
+0xfe,0x0f,0xf8,0x03,0xfe,0x0f,0xf8,0x03,0xfe,0x0f,0xf8,0x03,0xfe,0x0f,0xf8,0x03,
+0xfe,0x0f,0xf8,0x07,0xfe,0x0f,0xfc,0x07,0xfc,0x07,0xfe,0x0f,0xfc,0x07,0xff,0x3f,
+0xf8,0x03,0xff,0xff,0xf0,0x01,0xff,0xff,0xe0,0x00,0x7f,0xff,0xc0,0x00,0x7f,0xff,
+0xc0,0x01,0xff,0xff,0xf0,0x03,0xff,0xff,0xf8,0x07,0xff,0xff,0xfc,0x0f,0xfc,0x0f,
+0xfc,0x0f,0xf8,0x07,0xfe,0x1f,0xf8,0x03,0xfe,0x1f,0xf0,0x03,0xff,0x1f,0xf0,0x01,
+0xff,0x1f,0xf0,0x01,0xff,0x1f,0xf0,0x01,0xff,0x2b,0x1f,0xf0,0x03,0xff,0x1f,0xf8,
+0x03,0xff,0x1f,0xf8,0x07,0xff,0x1f,0xfe,0x0f,0xfe,0x0f,0xff,0xff,0xfe,0x0f,0xff,
+0xff,0xfc,0x07,0xff,0xff,0xfc,0x03,0xff,0xff,0xf8,0x01,0xff,0xff,0xf0,0x00,0x7f,
+0xff,0xc0,0x00,0x1f,0xfe,0x00,0x5c,0x00,0x07,0xf8,0x00,0x00,0x1f,0xff,0x00,0x00,
+0x7f,0xff,0x80,0x00,0xff,0xff,0xe0,0x01,0xff,0xff,0xf0,0x03,0xff,0xff,0xf0,0x07,
+0xff,0xff,0xf8,0x0f,0xfe,0x1f,0xfc,0x0f,0xfc,0x0f,0xfc,0x0f,0xf8,0x07,0xfe,0x1f,
+0xf8,0x03,0xfe,0x1f,0xf0,0x03,0xfe,0x1f,0xf0,0x03,0xfe,0x1f,0xf0,0x03,0xfe,0x1f,
+0xf0,0x03,0xff,0x1f,0xf0,0x03,0xff,0x1f,0xf0,0x03,0xff,0x1f,0xf0,0x03,0xff,0x1f,
+0xf0,0x03,0xff,0x1f,0xf8,0x03,0xff,0x1f,0xfc,0x03,0xff,0x0f,0xfe,0x07,0xff,0x0f,
+0xff,0xbf,0xff,0x07,0xfe,0xff,0x00,0x07,0xfe,0xff,0x47,0x03,0xff,0xff,0xfe,0x01,
+0xff,0xff,0xfe,0x00,0x7f,0xf3,0xfe,0x00,0x1f,0xc3,0xfe,0x00,0x00,0x03,0xfc,0x00,
+0x00,0x07,0xfc,0x00,0x00,0x0f,0xfc,0x00,0x00,0x0f,0xf8,0x00,0x00,0x3f,0xf8,0x00,
+0x00,0x7f,0xf0,0x00,0x03,0xff,0xe0,0x00,0x7f,0xff,0xc0,0x00,0x7f,0xff,0x80,0x00,
+0x7f,0xff,0x00,0x00,0x7f,0xfe,0x00,0x00,0x7f,0xf8,0x00,0x00,0x7f,0xe0,0x00,0x00,
+0x7f,0x00,0x00,0x7f,0x00,0x07,0xf0,0x00,0x00,0x3f,0xfe,0x00,0x00,0x7f,0x7f,0x00,
+0x00,0xf0,0x07,0x80,0x01,0xe0,0x03,0xc0,0x03,0xc0,0x01,0xe0,0x03,0x80,0x00,0xe0,
+0x07,0x80,0x00,0x70,0x07,0x00,0x00,0x70,0x07,0x00,0x00,0x70,0x06,0x00,0x00,0x38,
 0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,
-0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x18,0x0e,0x00,0x00,0x18,0x0e,0x00,0x00,0x18,
+0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x18,
 0x0e,0x00,0x00,0x18,0x0e,0x00,0x00,0x18,0x0e,0x00,0x00,0x18,0x0e,0x00,0x00,0x18,
-0x0e,0x00,0x00,0x18,0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,
-0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x06,0x00,0x00,0x38,
-0x07,0x00,0x00,0x78,0x07,0x00,0x00,0x70,0x07,0x80,0x00,0x70,0x03,0x80,0x00,0xe0,
-0x03,0xc0,0x00,0xe0,0x01,0xe0,0x01,0xc0,0x00,0xf0,0x07,0xc0,0x00,0x7c,0x1f,0x80,
-0x00,0x3f,0xfe,0x00,0x00,0x0f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-Element DIGIT_LIGHT_0{DIGIT_LIGHT_0_BYTE_WIDTH, DIGIT_LIGHT_0_ADVANCE, DIGIT_LIGHT_0_DATA};
-
-const int DIGIT_LIGHT_1_BYTE_WIDTH = 3;
-const int DIGIT_LIGHT_1_ADVANCE = 34;
-const unsigned char DIGIT_LIGHT_1_DATA[180] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,
-0x03,0xf0,0x00,0x0f,0xf0,0x00,0x7f,0x70,0x03,0xf8,0x70,0x03,0xe0,0x70,0x03,0x00,
-0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,
+0x0e,0x00,0x00,0x18,0x0e,0x00,0x00,0x18,0x0e,0x00,0x00,0x18,0x0e,0x00,0x00,0x38,
+0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,
+0x0e,0x00,0x00,0x38,0x2b,0x06,0x00,0x00,0x38,0x07,0x00,0x00,0x78,0x07,0x00,0x00,
+0x70,0x07,0x80,0x00,0x70,0x03,0x80,0x00,0xe0,0x03,0xc0,0x00,0xe0,0x01,0xe0,0x01,
+0xc0,0x00,0xf0,0x07,0xc0,0x00,0x7c,0x1f,0x80,0x00,0x3f,0xfe,0x00,0x00,0x0f,0xf8,
+0x00,0x7d,0x00,0x00,0x70,0x00,0x03,0xf0,0x00,0x0f,0xf0,0x00,0x7f,0x70,0x03,0xf8,
+0x70,0x03,0xe0,0x70,0x03,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,
 0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,
 0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,
 0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,
 0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,
 0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,
-0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00};
-Element DIGIT_LIGHT_1{DIGIT_LIGHT_1_BYTE_WIDTH, DIGIT_LIGHT_1_ADVANCE, DIGIT_LIGHT_1_DATA};
-
-const int DIGIT_LIGHT_2_BYTE_WIDTH = 4;
-const int DIGIT_LIGHT_2_ADVANCE = 34;
-const unsigned char DIGIT_LIGHT_2_DATA[240] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf0,0x00,
-0x00,0x3f,0xfe,0x00,0x00,0xff,0x7f,0x00,0x01,0xf0,0x07,0xc0,0x03,0xc0,0x03,0xc0,
-0x07,0x80,0x01,0xe0,0x07,0x00,0x00,0xe0,0x0e,0x00,0x00,0x70,0x0e,0x00,0x00,0x70,
-0x0e,0x00,0x00,0x70,0x0c,0x00,0x00,0x70,0x1c,0x00,0x00,0x70,0x00,0x00,0x00,0x70,
-0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0xe0,
-0x00,0x00,0x00,0xe0,0x00,0x00,0x01,0xc0,0x00,0x00,0x03,0x80,0x00,0x00,0x03,0x80,
-0x00,0x00,0x07,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x3c,0x00,
-0x00,0x00,0x78,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0xe0,0x00,0x00,0x01,0xc0,0x00,
-0x00,0x03,0x80,0x00,0x00,0x07,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x1e,0x00,0x00,
-0x00,0x3c,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x00,
-0x01,0xc0,0x00,0x00,0x03,0x80,0x00,0x00,0x07,0x00,0x00,0x00,0x0f,0xff,0xff,0xfc,
-0x0f,0xff,0xff,0xfc,0x0f,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-Element DIGIT_LIGHT_2{DIGIT_LIGHT_2_BYTE_WIDTH, DIGIT_LIGHT_2_ADVANCE, DIGIT_LIGHT_2_DATA};
-
-const int DIGIT_LIGHT_3_BYTE_WIDTH = 4;
-const int DIGIT_LIGHT_3_ADVANCE = 34;
-const unsigned char DIGIT_LIGHT_3_DATA[240] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,
-0x00,0x3f,0xfe,0x00,0x00,0xff,0x7f,0x80,0x01,0xf0,0x07,0xc0,0x03,0xc0,0x01,0xe0,
-0x07,0x80,0x00,0xe0,0x07,0x00,0x00,0xf0,0x0f,0x00,0x00,0x70,0x0e,0x00,0x00,0x70,
-0x0e,0x00,0x00,0x70,0x0e,0x00,0x00,0x30,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x30,
-0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xe0,
-0x00,0x00,0x01,0xc0,0x00,0x00,0x03,0x80,0x00,0x00,0x1f,0x00,0x00,0x0f,0xfc,0x00,
-0x00,0x0f,0xfc,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x01,0xe0,
-0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,
-0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x1c,0x00,0x00,0x38,
-0x1c,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x0f,0x00,0x00,0x70,
-0x07,0x00,0x00,0x70,0x07,0x80,0x00,0xe0,0x03,0xe0,0x03,0xc0,0x01,0xf8,0x0f,0x80,
-0x00,0x7f,0xff,0x00,0x00,0x1f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-Element DIGIT_LIGHT_3{DIGIT_LIGHT_3_BYTE_WIDTH, DIGIT_LIGHT_3_ADVANCE, DIGIT_LIGHT_3_DATA};
-
-const int DIGIT_LIGHT_4_BYTE_WIDTH = 5;
-const int DIGIT_LIGHT_4_ADVANCE = 34;
-const unsigned char DIGIT_LIGHT_4_DATA[300] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x07,0x80,0x00,0x00,0x00,
-0x0f,0x80,0x00,0x00,0x00,0x1f,0x80,0x00,0x00,0x00,0x1b,0x80,0x00,0x00,0x00,0x3b,
-0x80,0x00,0x00,0x00,0x73,0x80,0x00,0x00,0x00,0x73,0x80,0x00,0x00,0x00,0xe3,0x80,
-0x00,0x00,0x01,0xc3,0x80,0x00,0x00,0x01,0xc3,0x80,0x00,0x00,0x03,0x83,0x80,0x00,
-0x00,0x07,0x03,0x80,0x00,0x00,0x07,0x03,0x80,0x00,0x00,0x0e,0x03,0x80,0x00,0x00,
-0x1c,0x03,0x80,0x00,0x00,0x1c,0x03,0x80,0x00,0x00,0x38,0x03,0x80,0x00,0x00,0x70,
-0x03,0x80,0x00,0x00,0x70,0x03,0x80,0x00,0x00,0xe0,0x03,0x80,0x00,0x01,0xc0,0x03,
-0x80,0x00,0x01,0xc0,0x03,0x80,0x00,0x03,0x80,0x03,0x80,0x00,0x07,0x00,0x03,0x80,
-0x00,0x07,0x00,0x03,0x80,0x00,0x0e,0x00,0x03,0x80,0x00,0x1c,0x00,0x03,0x80,0x00,
-0x1e,0x00,0x03,0xc0,0x00,0x3f,0xff,0xff,0xff,0x00,0x3f,0xff,0xff,0xff,0x00,0x00,
-0x00,0x03,0x80,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,
-0x03,0x80,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x03,
-0x80,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x03,0x80,
-0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-Element DIGIT_LIGHT_4{DIGIT_LIGHT_4_BYTE_WIDTH, DIGIT_LIGHT_4_ADVANCE, DIGIT_LIGHT_4_DATA};
-
-const int DIGIT_LIGHT_5_BYTE_WIDTH = 4;
-const int DIGIT_LIGHT_5_ADVANCE = 34;
-const unsigned char DIGIT_LIGHT_5_DATA[240] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x7f,0xff,0xfc,0x00,0x7f,0xff,0xfc,0x00,0xe0,0x00,0x00,0x00,0xe0,0x00,0x00,
-0x00,0xe0,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0xe0,0x00,0x00,
-0x00,0xe0,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0xc0,0x00,0x00,
-0x01,0xc0,0x00,0x00,0x01,0xc0,0x00,0x00,0x01,0xc0,0x00,0x00,0x01,0xc3,0xfc,0x00,
-0x01,0xdf,0xff,0x00,0x01,0xff,0xff,0xc0,0x01,0xf0,0x03,0xe0,0x01,0xe0,0x01,0xf0,
-0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x3c,
-0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x1c,
-0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x1c,0x07,0x00,0x00,0x1c,
-0x07,0x00,0x00,0x1c,0x03,0x80,0x00,0x1c,0x03,0x80,0x00,0x38,0x03,0xc0,0x00,0x38,
-0x01,0xc0,0x00,0x78,0x01,0xe0,0x00,0xf0,0x00,0xf0,0x01,0xe0,0x00,0x7e,0x07,0xc0,
-0x00,0x1f,0xff,0x80,0x00,0x07,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-Element DIGIT_LIGHT_5{DIGIT_LIGHT_5_BYTE_WIDTH, DIGIT_LIGHT_5_ADVANCE, DIGIT_LIGHT_5_DATA};
-
-const int DIGIT_LIGHT_6_BYTE_WIDTH = 4;
-const int DIGIT_LIGHT_6_ADVANCE = 34;
-const unsigned char DIGIT_LIGHT_6_DATA[240] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,
-0x00,0x00,0x7f,0x00,0x00,0x03,0xff,0x00,0x00,0x07,0xe0,0x00,0x00,0x1f,0x00,0x00,
-0x00,0x3c,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x00,
-0x01,0xc0,0x00,0x00,0x01,0xc0,0x00,0x00,0x03,0x80,0x00,0x00,0x03,0x80,0x00,0x00,
-0x03,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x01,0xf0,0x00,0x07,0x0f,0xfe,0x00,
-0x06,0x3f,0xff,0x80,0x0e,0x78,0x07,0xc0,0x0e,0xe0,0x01,0xe0,0x0f,0xc0,0x00,0xf0,
-0x0f,0x80,0x00,0x70,0x0f,0x00,0x00,0x78,0x0f,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,
-0x0e,0x00,0x00,0x1c,0x0e,0x00,0x00,0x1c,0x0e,0x00,0x00,0x1c,0x0e,0x00,0x00,0x1c,
-0x0e,0x00,0x00,0x1c,0x0e,0x00,0x00,0x1c,0x0e,0x00,0x00,0x1c,0x07,0x00,0x00,0x1c,
-0x07,0x00,0x00,0x38,0x07,0x00,0x00,0x38,0x03,0x80,0x00,0x38,0x03,0x80,0x00,0x70,
-0x01,0xc0,0x00,0xf0,0x01,0xe0,0x01,0xe0,0x00,0xf8,0x03,0xc0,0x00,0x7e,0x0f,0x80,
-0x00,0x1f,0xff,0x00,0x00,0x07,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-Element DIGIT_LIGHT_6{DIGIT_LIGHT_6_BYTE_WIDTH, DIGIT_LIGHT_6_ADVANCE, DIGIT_LIGHT_6_DATA};
-
-const int DIGIT_LIGHT_7_BYTE_WIDTH = 4;
-const int DIGIT_LIGHT_7_ADVANCE = 34;
-const unsigned char DIGIT_LIGHT_7_DATA[240] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x1f,0xff,0xff,0xfc,0x1f,0xff,0xff,0xfc,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x38,
-0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xe0,
-0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0xc0,0x00,0x00,0x01,0xc0,0x00,0x00,0x01,0x80,
-0x00,0x00,0x03,0x80,0x00,0x00,0x03,0x80,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,
-0x00,0x00,0x0e,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x1c,0x00,
-0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x70,0x00,
-0x00,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0xe0,0x00,0x00,0x01,0xc0,0x00,
-0x00,0x01,0xc0,0x00,0x00,0x03,0x80,0x00,0x00,0x03,0x80,0x00,0x00,0x07,0x00,0x00,
-0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x0e,0x00,0x00,
-0x00,0x1c,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,
-0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-Element DIGIT_LIGHT_7{DIGIT_LIGHT_7_BYTE_WIDTH, DIGIT_LIGHT_7_ADVANCE, DIGIT_LIGHT_7_DATA};
-
-const int DIGIT_LIGHT_8_BYTE_WIDTH = 4;
-const int DIGIT_LIGHT_8_ADVANCE = 34;
-const unsigned char DIGIT_LIGHT_8_DATA[240] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,
-0x00,0x3f,0xfe,0x00,0x00,0x7f,0x7f,0x80,0x01,0xf0,0x07,0xc0,0x03,0xe0,0x01,0xe0,
-0x03,0xc0,0x00,0xe0,0x07,0x80,0x00,0xf0,0x07,0x00,0x00,0x70,0x07,0x00,0x00,0x78,
-0x07,0x00,0x00,0x38,0x06,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x07,0x00,0x00,0x38,
-0x07,0x00,0x00,0x38,0x07,0x00,0x00,0x70,0x07,0x00,0x00,0x70,0x03,0x80,0x00,0xe0,
-0x01,0xc0,0x01,0xe0,0x01,0xe0,0x03,0xc0,0x00,0x7c,0x0f,0x80,0x00,0x3f,0xfe,0x00,
-0x00,0x1f,0xfc,0x00,0x00,0x7e,0x1f,0x80,0x01,0xe0,0x03,0xc0,0x03,0xc0,0x01,0xe0,
-0x07,0x80,0x00,0x70,0x07,0x00,0x00,0x78,0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,
-0x0e,0x00,0x00,0x1c,0x1c,0x00,0x00,0x1c,0x1c,0x00,0x00,0x1c,0x1c,0x00,0x00,0x1c,
-0x0c,0x00,0x00,0x1c,0x0e,0x00,0x00,0x1c,0x0e,0x00,0x00,0x38,0x0f,0x00,0x00,0x38,
-0x07,0x00,0x00,0x78,0x07,0x80,0x00,0xf0,0x03,0xe0,0x01,0xe0,0x01,0xf8,0x0f,0xc0,
-0x00,0x7f,0xff,0x00,0x00,0x1f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-Element DIGIT_LIGHT_8{DIGIT_LIGHT_8_BYTE_WIDTH, DIGIT_LIGHT_8_ADVANCE, DIGIT_LIGHT_8_DATA};
-
-const int DIGIT_LIGHT_9_BYTE_WIDTH = 4;
-const int DIGIT_LIGHT_9_ADVANCE = 34;
-const unsigned char DIGIT_LIGHT_9_DATA[240] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf0,0x00,
-0x00,0x3f,0xfc,0x00,0x00,0xff,0xff,0x00,0x01,0xf0,0x0f,0x80,0x03,0xc0,0x03,0xc0,
-0x03,0x80,0x01,0xc0,0x07,0x80,0x00,0xe0,0x07,0x00,0x00,0xe0,0x0e,0x00,0x00,0x70,
-0x0e,0x00,0x00,0x70,0x0e,0x00,0x00,0x70,0x0c,0x00,0x00,0x38,0x1c,0x00,0x00,0x38,
-0x1c,0x00,0x00,0x38,0x1c,0x00,0x00,0x38,0x1c,0x00,0x00,0x38,0x1c,0x00,0x00,0x38,
-0x1c,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x78,
-0x07,0x00,0x00,0x78,0x07,0x80,0x00,0xf8,0x03,0x80,0x01,0xf8,0x03,0xc0,0x07,0xb8,
-0x01,0xf0,0x0f,0x38,0x00,0xff,0xfc,0x38,0x00,0x3f,0xf8,0x38,0x00,0x07,0x80,0x30,
-0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0xe0,
-0x00,0x00,0x00,0xe0,0x00,0x00,0x01,0xc0,0x00,0x00,0x03,0xc0,0x00,0x00,0x07,0x80,
-0x00,0x00,0x0f,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0xfc,0x00,0x00,0x1f,0xf0,0x00,
-0x00,0x7f,0xc0,0x00,0x00,0x7e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-Element DIGIT_LIGHT_9{DIGIT_LIGHT_9_BYTE_WIDTH, DIGIT_LIGHT_9_ADVANCE, DIGIT_LIGHT_9_DATA};
-
-const Element DIGITS_LIGHT[] = {
-        DIGIT_LIGHT_0, DIGIT_LIGHT_1, DIGIT_LIGHT_2, DIGIT_LIGHT_3, DIGIT_LIGHT_4,
-        DIGIT_LIGHT_5, DIGIT_LIGHT_6, DIGIT_LIGHT_7, DIGIT_LIGHT_8, DIGIT_LIGHT_9
-};const int DIGIT_SMALL_0_BYTE_WIDTH = 3;
-const int DIGIT_SMALL_0_ADVANCE = 18;
-const unsigned char DIGIT_SMALL_0_DATA[180] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,0x0f,0xfc,
-0x00,0x1f,0xfc,0x00,0x3e,0x3e,0x00,0x3c,0x1e,0x00,0x3c,0x1f,0x00,0x3c,0x1f,0x00,
-0x3c,0x1f,0x00,0x3c,0x1f,0x00,0x3c,0x1f,0x00,0x3c,0x1f,0x00,0x3c,0x1f,0x00,0x3c,
-0x1f,0x00,0x3c,0x1f,0x00,0x3c,0x1f,0x00,0x3c,0x1e,0x00,0x3e,0x1e,0x00,0x1f,0x3e,
-0x00,0x1f,0xfc,0x00,0x0f,0xf8,0x00,0x03,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00};
-Element DIGIT_SMALL_0{DIGIT_SMALL_0_BYTE_WIDTH, DIGIT_SMALL_0_ADVANCE, DIGIT_SMALL_0_DATA};
-
-const int DIGIT_SMALL_1_BYTE_WIDTH = 2;
-const int DIGIT_SMALL_1_ADVANCE = 18;
-const unsigned char DIGIT_SMALL_1_DATA[120] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x30,0x01,0xf0,0x0f,0xf0,0x1f,0xf0,0x1f,0xf0,0x18,0xf0,0x00,0xf0,
-0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,
-0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-Element DIGIT_SMALL_1{DIGIT_SMALL_1_BYTE_WIDTH, DIGIT_SMALL_1_ADVANCE, DIGIT_SMALL_1_DATA};
-
-const int DIGIT_SMALL_2_BYTE_WIDTH = 3;
-const int DIGIT_SMALL_2_ADVANCE = 18;
-const unsigned char DIGIT_SMALL_2_DATA[180] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf8,0x00,0x1f,0xfc,
-0x00,0x3f,0xfe,0x00,0x3e,0x3e,0x00,0x7c,0x1e,0x00,0x7c,0x1e,0x00,0x00,0x1e,0x00,
-0x00,0x1e,0x00,0x00,0x3e,0x00,0x00,0x7c,0x00,0x00,0x78,0x00,0x00,0xf8,0x00,0x01,
-0xf0,0x00,0x03,0xe0,0x00,0x07,0xc0,0x00,0x0f,0x80,0x00,0x1f,0x00,0x00,0x3f,0xff,
-0x00,0x3f,0xff,0x00,0x3f,0xff,0x00,0x3f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00};
-Element DIGIT_SMALL_2{DIGIT_SMALL_2_BYTE_WIDTH, DIGIT_SMALL_2_ADVANCE, DIGIT_SMALL_2_DATA};
-
-const int DIGIT_SMALL_3_BYTE_WIDTH = 3;
-const int DIGIT_SMALL_3_ADVANCE = 18;
-const unsigned char DIGIT_SMALL_3_DATA[180] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf8,0x00,0x1f,0xfc,
-0x00,0x3f,0xfe,0x00,0x3e,0x3e,0x00,0x7c,0x1e,0x00,0x00,0x1f,0x00,0x00,0x1e,0x00,
-0x00,0x1e,0x00,0x00,0xfc,0x00,0x03,0xf8,0x00,0x03,0xf8,0x00,0x03,0xfc,0x00,0x00,
-0x1e,0x00,0x00,0x1f,0x00,0x00,0x1f,0x00,0x78,0x1f,0x00,0x7c,0x1f,0x00,0x3e,0x3e,
-0x00,0x3f,0xfe,0x00,0x1f,0xfc,0x00,0x07,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00};
-Element DIGIT_SMALL_3{DIGIT_SMALL_3_BYTE_WIDTH, DIGIT_SMALL_3_ADVANCE, DIGIT_SMALL_3_DATA};
-
-const int DIGIT_SMALL_4_BYTE_WIDTH = 3;
-const int DIGIT_SMALL_4_ADVANCE = 18;
-const unsigned char DIGIT_SMALL_4_DATA[180] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x7c,
-0x00,0x00,0xfc,0x00,0x01,0xfc,0x00,0x01,0xfc,0x00,0x03,0xfc,0x00,0x07,0xbc,0x00,
-0x07,0x3c,0x00,0x0f,0x3c,0x00,0x0e,0x3c,0x00,0x1e,0x3c,0x00,0x3c,0x3c,0x00,0x3c,
-0x3c,0x00,0x7f,0xff,0x00,0x7f,0xff,0x00,0x7f,0xff,0x00,0x00,0x3c,0x00,0x00,0x3c,
-0x00,0x00,0x3c,0x00,0x00,0x3c,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00};
-Element DIGIT_SMALL_4{DIGIT_SMALL_4_BYTE_WIDTH, DIGIT_SMALL_4_ADVANCE, DIGIT_SMALL_4_DATA};
-
-const int DIGIT_SMALL_5_BYTE_WIDTH = 3;
-const int DIGIT_SMALL_5_ADVANCE = 18;
-const unsigned char DIGIT_SMALL_5_DATA[180] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xfe,0x00,0x1f,0xfe,
-0x00,0x1f,0xfe,0x00,0x1e,0x00,0x00,0x1e,0x00,0x00,0x3c,0x00,0x00,0x3c,0x00,0x00,
-0x3c,0xf0,0x00,0x3f,0xfc,0x00,0x3f,0xfe,0x00,0x1c,0x3e,0x00,0x00,0x1e,0x00,0x00,
-0x1f,0x00,0x00,0x1f,0x00,0x00,0x1f,0x00,0x3c,0x1f,0x00,0x3c,0x1e,0x00,0x3f,0x3e,
-0x00,0x1f,0xfc,0x00,0x0f,0xf8,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00};
-Element DIGIT_SMALL_5{DIGIT_SMALL_5_BYTE_WIDTH, DIGIT_SMALL_5_ADVANCE, DIGIT_SMALL_5_DATA};
-
-const int DIGIT_SMALL_6_BYTE_WIDTH = 3;
-const int DIGIT_SMALL_6_ADVANCE = 18;
-const unsigned char DIGIT_SMALL_6_DATA[180] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x03,0xf8,
-0x00,0x07,0xf8,0x00,0x0f,0xc0,0x00,0x1f,0x00,0x00,0x1e,0x00,0x00,0x3e,0x00,0x00,
-0x3c,0xf8,0x00,0x3f,0xfc,0x00,0x3f,0xfe,0x00,0x3e,0x3f,0x00,0x3c,0x1f,0x00,0x3c,
-0x0f,0x00,0x3c,0x0f,0x00,0x3c,0x0f,0x00,0x3c,0x0f,0x00,0x3e,0x1f,0x00,0x1f,0x3e,
-0x00,0x1f,0xfe,0x00,0x0f,0xfc,0x00,0x03,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00};
-Element DIGIT_SMALL_6{DIGIT_SMALL_6_BYTE_WIDTH, DIGIT_SMALL_6_ADVANCE, DIGIT_SMALL_6_DATA};
-
-const int DIGIT_SMALL_7_BYTE_WIDTH = 3;
-const int DIGIT_SMALL_7_ADVANCE = 18;
-const unsigned char DIGIT_SMALL_7_DATA[180] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0x00,0x7f,0xff,
-0x00,0x7f,0xff,0x00,0x00,0x1e,0x00,0x00,0x1e,0x00,0x00,0x3c,0x00,0x00,0x3c,0x00,
-0x00,0x7c,0x00,0x00,0x78,0x00,0x00,0xf8,0x00,0x00,0xf0,0x00,0x00,0xf0,0x00,0x01,
-0xe0,0x00,0x01,0xe0,0x00,0x03,0xe0,0x00,0x03,0xc0,0x00,0x07,0xc0,0x00,0x07,0x80,
-0x00,0x0f,0x80,0x00,0x0f,0x80,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00};
-Element DIGIT_SMALL_7{DIGIT_SMALL_7_BYTE_WIDTH, DIGIT_SMALL_7_ADVANCE, DIGIT_SMALL_7_DATA};
-
-const int DIGIT_SMALL_8_BYTE_WIDTH = 3;
-const int DIGIT_SMALL_8_ADVANCE = 18;
-const unsigned char DIGIT_SMALL_8_DATA[180] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf8,0x00,0x1f,0xfc,
-0x00,0x1f,0xfe,0x00,0x3e,0x3e,0x00,0x3e,0x1e,0x00,0x3c,0x1e,0x00,0x3c,0x1e,0x00,
-0x3e,0x3e,0x00,0x1f,0xfc,0x00,0x0f,0xf8,0x00,0x0f,0xf8,0x00,0x1f,0xfc,0x00,0x3e,
-0x1e,0x00,0x3c,0x1f,0x00,0x3c,0x1f,0x00,0x3c,0x1f,0x00,0x3c,0x1f,0x00,0x3f,0x3e,
-0x00,0x1f,0xfe,0x00,0x0f,0xfc,0x00,0x07,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00};
-Element DIGIT_SMALL_8{DIGIT_SMALL_8_BYTE_WIDTH, DIGIT_SMALL_8_ADVANCE, DIGIT_SMALL_8_DATA};
-
-const int DIGIT_SMALL_9_BYTE_WIDTH = 3;
-const int DIGIT_SMALL_9_ADVANCE = 18;
-const unsigned char DIGIT_SMALL_9_DATA[180] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,0x0f,0xf8,
-0x00,0x1f,0xfc,0x00,0x3e,0x3e,0x00,0x3c,0x1e,0x00,0x3c,0x1e,0x00,0x7c,0x1f,0x00,
-0x7c,0x1f,0x00,0x3c,0x1f,0x00,0x3c,0x1f,0x00,0x3e,0x3f,0x00,0x1f,0xff,0x00,0x0f,
-0xfe,0x00,0x07,0x9e,0x00,0x00,0x1e,0x00,0x00,0x3e,0x00,0x00,0x7c,0x00,0x03,0xf8,
-0x00,0x07,0xf0,0x00,0x07,0xe0,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00};
-Element DIGIT_SMALL_9{DIGIT_SMALL_9_BYTE_WIDTH, DIGIT_SMALL_9_ADVANCE, DIGIT_SMALL_9_DATA};
-
-const Element DIGITS_SMALL[] = {
-        DIGIT_SMALL_0, DIGIT_SMALL_1, DIGIT_SMALL_2, DIGIT_SMALL_3, DIGIT_SMALL_4,
-        DIGIT_SMALL_5, DIGIT_SMALL_6, DIGIT_SMALL_7, DIGIT_SMALL_8, DIGIT_SMALL_9
-};const int MINS_BYTE_WIDTH = 9;
-const int MINS_ADVANCE = 67;
-const unsigned char MINS_DATA[540] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x78,
-0x78,0x0f,0x0f,0x1e,0x00,0xf8,0x00,0x3d,0xfc,0xfe,0x0f,0x0f,0x7f,0x03,0xfe,0x00,
-0x3f,0xff,0xfe,0x0f,0x0f,0xff,0x87,0xff,0x00,0x3f,0x7f,0xbf,0x0f,0x0f,0xdf,0x87,
-0x8f,0x80,0x3c,0x3e,0x1f,0x0f,0x0f,0x07,0x8f,0x07,0x80,0x3c,0x1e,0x0f,0x0f,0x0f,
-0x07,0x8f,0x80,0x00,0x3c,0x1e,0x0f,0x0f,0x0f,0x07,0x87,0xe0,0x00,0x3c,0x1e,0x0f,
-0x0f,0x0f,0x07,0x87,0xfc,0x00,0x3c,0x1e,0x0f,0x0f,0x0f,0x07,0x81,0xff,0x00,0x3c,
-0x1e,0x0f,0x0f,0x0f,0x07,0x80,0x3f,0x80,0x3c,0x1e,0x0f,0x0f,0x0f,0x07,0x80,0x0f,
-0x80,0x3c,0x1e,0x0f,0x0f,0x0f,0x07,0x8f,0x07,0x80,0x3c,0x1e,0x0f,0x0f,0x0f,0x07,
-0x8f,0x87,0x80,0x3c,0x1e,0x0f,0x0f,0x0f,0x07,0x87,0xff,0x80,0x3c,0x1e,0x0f,0x0f,
-0x0f,0x07,0x83,0xff,0x00,0x3c,0x1e,0x0f,0x0f,0x0f,0x07,0x80,0xfc,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-Element MINS{MINS_BYTE_WIDTH, MINS_ADVANCE, MINS_DATA};
-
-const int SEP_BYTE_WIDTH = 2;
-const int SEP_ADVANCE = 18;
-const unsigned char SEP_DATA[120] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x3f,0xfe,0x3f,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-Element SEP{SEP_BYTE_WIDTH, SEP_ADVANCE, SEP_DATA};
-
-const int COLON_BYTE_WIDTH = 2;
-const int COLON_ADVANCE = 19;
-const unsigned char COLON_DATA[120] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xf0,0x07,0xf8,
-0x0f,0xfc,0x0f,0xfc,0x0f,0xfc,0x0f,0xfc,0x0f,0xfc,0x07,0xf8,0x03,0xe0,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xf0,0x07,0xf8,0x0f,0xfc,
-0x0f,0xfc,0x0f,0xfc,0x0f,0xfc,0x0f,0xfc,0x07,0xf8,0x03,0xe0,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-Element COLON{COLON_BYTE_WIDTH, COLON_ADVANCE, COLON_DATA};
-
-const int COLON_LIGHT_BYTE_WIDTH = 1;
-const int COLON_LIGHT_ADVANCE = 13;
-const unsigned char COLON_LIGHT_DATA[60] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
-0x07,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0e,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-Element COLON_LIGHT{COLON_LIGHT_BYTE_WIDTH, COLON_LIGHT_ADVANCE, COLON_LIGHT_DATA};
-
-const int COLON_SMALL_BYTE_WIDTH = 1;
-const int COLON_SMALL_ADVANCE = 10;
-const unsigned char COLON_SMALL_DATA[60] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x3e,
-0x3e,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x3e,0x3e,0x1c,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-Element COLON_SMALL{COLON_SMALL_BYTE_WIDTH, COLON_SMALL_ADVANCE, COLON_SMALL_DATA};
-
-const int STATUS_BYTE_WIDTH = 12;
-const int STATUS_ADVANCE = 105;
-const unsigned char STATUS_DATA[720] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfc,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xfe,0x07,0x80,0x00,0x00,0xf0,0x00,
-0x00,0x00,0x00,0x00,0x1f,0xff,0x07,0xc0,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x00,
-0x3f,0x1f,0x87,0xc0,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x00,0x3e,0x0f,0x87,0xc0,
-0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x00,0x3c,0x07,0x9f,0xf0,0x3f,0x03,0xfc,0x78,
-0x3c,0x07,0xe0,0x3c,0x3e,0x00,0x1f,0xf0,0xff,0xc7,0xfc,0x78,0x3e,0x1f,0xf8,0x3c,
-0x3f,0x00,0x1f,0xf1,0xff,0xc7,0xfc,0x78,0x3e,0x3f,0xfc,0x3c,0x1f,0xe0,0x07,0xc1,
-0xe3,0xe1,0xf0,0x78,0x3e,0x3c,0x7c,0x18,0x0f,0xf8,0x07,0xc3,0xe1,0xe1,0xf0,0x78,
-0x3e,0x3c,0x3c,0x00,0x07,0xfe,0x07,0xc0,0x01,0xe1,0xf0,0x78,0x3e,0x3c,0x00,0x00,
-0x00,0xff,0x07,0xc0,0x03,0xe1,0xf0,0x78,0x3e,0x3f,0x00,0x00,0x00,0x3f,0x87,0xc0,
-0xff,0xe1,0xf0,0x78,0x3e,0x1f,0xf0,0x00,0x00,0x0f,0x87,0xc1,0xff,0xe1,0xf0,0x78,
-0x3e,0x0f,0xf8,0x00,0x7c,0x07,0x87,0xc3,0xe1,0xe1,0xf0,0x78,0x3e,0x01,0xfc,0x00,
-0x7c,0x07,0x87,0xc3,0xc1,0xe1,0xf0,0x78,0x3e,0x00,0x3c,0x00,0x3e,0x0f,0x87,0xc3,
-0xc1,0xe1,0xf0,0x78,0x3e,0x78,0x3c,0x00,0x3f,0x1f,0x87,0xe3,0xe3,0xe0,0xf8,0x7c,
-0x7e,0x7c,0x3c,0x3c,0x1f,0xff,0x03,0xf3,0xff,0xe0,0xfe,0x7f,0xfe,0x3f,0xfc,0x3c,
-0x0f,0xfe,0x03,0xf1,0xff,0xf0,0xfe,0x3f,0xfe,0x1f,0xf8,0x3c,0x01,0xf8,0x01,0xf0,
-0x79,0xf0,0x3e,0x1f,0x3e,0x07,0xe0,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-Element STATUS{STATUS_BYTE_WIDTH, STATUS_ADVANCE, STATUS_DATA};
-
-const int BATT_BYTE_WIDTH = 8;
-const int BATT_ADVANCE = 73;
-const unsigned char BATT_DATA[480] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,
-0x3f,0xff,0x00,0x00,0x03,0xc0,0xf0,0x00,0x3f,0xff,0x80,0x00,0x03,0xc0,0xf0,0x00,
-0x3e,0x1f,0x80,0x00,0x03,0xc0,0xf0,0x00,0x3c,0x0f,0x80,0x00,0x03,0xc0,0xf0,0x00,
-0x3c,0x07,0x80,0x7c,0x0f,0xfb,0xfe,0x3c,0x3c,0x07,0x83,0xff,0x0f,0xfb,0xfe,0x3e,
-0x3c,0x0f,0x87,0xff,0x8f,0xfb,0xfe,0x3c,0x3e,0x1f,0x07,0xcf,0x87,0xc0,0xf8,0x1c,
-0x3f,0xfe,0x07,0x87,0x83,0xc0,0xf0,0x00,0x3f,0xfe,0x00,0x07,0xc3,0xc0,0xf0,0x00,
-0x3f,0xff,0x80,0x07,0xc3,0xc0,0xf0,0x00,0x3c,0x07,0x81,0xff,0xc3,0xc0,0xf0,0x00,
-0x3c,0x07,0xc7,0xff,0xc3,0xc0,0xf0,0x00,0x3c,0x07,0xc7,0x87,0xc3,0xc0,0xf0,0x00,
-0x3c,0x07,0xcf,0x87,0xc3,0xc0,0xf0,0x00,0x3c,0x0f,0xcf,0x87,0xc3,0xc0,0xf0,0x00,
-0x3f,0xff,0x8f,0x8f,0xc3,0xe0,0xf8,0x3c,0x3f,0xff,0x87,0xff,0xc3,0xf8,0xfe,0x3e,
-0x3f,0xfe,0x07,0xff,0xc1,0xf8,0x7e,0x3c,0x3f,0xf8,0x01,0xf3,0xc0,0xf8,0x3e,0x1c,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,
+0x2f,0x00,0x0f,0xf0,0x00,0x00,0x3f,0xfe,0x00,0x00,0xff,0x7f,0x00,0x01,0xf0,0x07,
+0xc0,0x03,0xc0,0x03,0xc0,0x07,0x80,0x01,0xe0,0x07,0x00,0x00,0xe0,0x0e,0x00,0x00,
+0x70,0x0e,0x00,0x00,0x70,0x0e,0x00,0x00,0x70,0x0c,0x00,0x00,0x70,0x1c,0x00,0x00,
+0x70,0xfe,0x00,0x00,0x70,0xfe,0x00,0x00,0x70,0xfe,0x00,0x00,0x70,0xfe,0x00,0x00,
+0x60,0xfe,0x00,0x00,0xe0,0xfe,0x00,0x0f,0xe0,0x00,0x00,0x01,0xc0,0x00,0x00,0x03,
+0x80,0x00,0x00,0x03,0x80,0x00,0x00,0x07,0xfe,0x00,0x00,0x0e,0xfe,0x00,0x00,0x1c,
+0xfe,0x00,0x00,0x3c,0xfe,0x00,0x00,0x78,0xfe,0x00,0x00,0xf0,0xfe,0x00,0x0b,0xe0,
+0x00,0x00,0x01,0xc0,0x00,0x00,0x03,0x80,0x00,0x00,0x07,0xfe,0x00,0x00,0x0f,0xfe,
+0x00,0x00,0x1e,0xfe,0x00,0x00,0x3c,0xfe,0x00,0x00,0x78,0xfe,0x00,0x00,0x70,0xfe,
+0x00,0x0b,0xe0,0x00,0x00,0x01,0xc0,0x00,0x00,0x03,0x80,0x00,0x00,0x07,0xfe,0x00,
+0x0b,0x0f,0xff,0xff,0xfc,0x0f,0xff,0xff,0xfc,0x0f,0xff,0xff,0xfc,0x2b,0x00,0x07,
+0xf0,0x00,0x00,0x3f,0xfe,0x00,0x00,0xff,0x7f,0x80,0x01,0xf0,0x07,0xc0,0x03,0xc0,
+0x01,0xe0,0x07,0x80,0x00,0xe0,0x07,0x00,0x00,0xf0,0x0f,0x00,0x00,0x70,0x0e,0x00,
+0x00,0x70,0x0e,0x00,0x00,0x70,0x0e,0x00,0x00,0x30,0xfe,0x00,0x00,0x38,0xfe,0x00,
+0x00,0x30,0xfe,0x00,0x00,0x70,0xfe,0x00,0x00,0x70,0xfe,0x00,0x00,0x70,0xfe,0x00,
+0x13,0xe0,0x00,0x00,0x01,0xc0,0x00,0x00,0x03,0x80,0x00,0x00,0x1f,0x00,0x00,0x0f,
+0xfc,0x00,0x00,0x0f,0xfc,0xfe,0x00,0x00,0xff,0xfe,0x00,0x05,0x07,0xc0,0x00,0x00,
+0x01,0xe0,0xfe,0x00,0x00,0xf0,0xfe,0x00,0x00,0x70,0xfe,0x00,0x00,0x38,0xfe,0x00,
+0x00,0x38,0xfe,0x00,0x00,0x38,0xfe,0x00,0x00,0x38,0xfe,0x00,0x2c,0x38,0x1c,0x00,
+0x00,0x38,0x1c,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x0f,0x00,
+0x00,0x70,0x07,0x00,0x00,0x70,0x07,0x80,0x00,0xe0,0x03,0xe0,0x03,0xc0,0x01,0xf8,
+0x0f,0x80,0x00,0x7f,0xff,0x00,0x00,0x1f,0xfc,0x00,0x74,0x00,0x00,0x07,0x80,0x00,
+0x00,0x07,0x80,0x00,0x00,0x0f,0x80,0x00,0x00,0x1f,0x80,0x00,0x00,0x1b,0x80,0x00,
+0x00,0x3b,0x80,0x00,0x00,0x73,0x80,0x00,0x00,0x73,0x80,0x00,0x00,0xe3,0x80,0x00,
+0x01,0xc3,0x80,0x00,0x01,0xc3,0x80,0x00,0x03,0x83,0x80,0x00,0x07,0x03,0x80,0x00,
+0x07,0x03,0x80,0x00,0x0e,0x03,0x80,0x00,0x1c,0x03,0x80,0x00,0x1c,0x03,0x80,0x00,
+0x38,0x03,0x80,0x00,0x70,0x03,0x80,0x00,0x70,0x03,0x80,0x00,0xe0,0x03,0x80,0x01,
+0xc0,0x03,0x80,0x01,0xc0,0x03,0x80,0x03,0x80,0x03,0x80,0x07,0x00,0x03,0x80,0x07,
+0x00,0x03,0x80,0x0e,0x00,0x03,0x80,0x1c,0x00,0x03,0x80,0x1e,0x00,0x03,0xc0,0x3f,
+0xfe,0xff,0x00,0x3f,0xfe,0xff,0x2b,0x00,0x00,0x03,0x80,0x00,0x00,0x03,0x80,0x00,
+0x00,0x03,0x80,0x00,0x00,0x03,0x80,0x00,0x00,0x03,0x80,0x00,0x00,0x03,0x80,0x00,
+0x00,0x03,0x80,0x00,0x00,0x03,0x80,0x00,0x00,0x03,0x80,0x00,0x00,0x03,0x80,0x00,
+0x00,0x03,0x80,0x09,0x00,0x7f,0xff,0xfc,0x00,0x7f,0xff,0xfc,0x00,0xe0,0xfe,0x00,
+0x00,0xe0,0xfe,0x00,0x00,0xe0,0xfe,0x00,0x00,0xe0,0xfe,0x00,0x00,0xe0,0xfe,0x00,
+0x00,0xe0,0xfe,0x00,0x00,0xe0,0xfe,0x00,0x00,0xc0,0xfe,0x00,0x00,0xc0,0xfe,0x00,
+0x22,0xc0,0x00,0x00,0x01,0xc0,0x00,0x00,0x01,0xc0,0x00,0x00,0x01,0xc0,0x00,0x00,
+0x01,0xc3,0xfc,0x00,0x01,0xdf,0xff,0x00,0x01,0xff,0xff,0xc0,0x01,0xf0,0x03,0xe0,
+0x01,0xe0,0x01,0xf0,0xfe,0x00,0x00,0x70,0xfe,0x00,0x00,0x78,0xfe,0x00,0x00,0x38,
+0xfe,0x00,0x00,0x3c,0xfe,0x00,0x00,0x1c,0xfe,0x00,0x00,0x1c,0xfe,0x00,0x00,0x1c,
+0xfe,0x00,0x00,0x1c,0xfe,0x00,0x00,0x1c,0xfe,0x00,0x00,0x1c,0xfe,0x00,0x2c,0x1c,
+0x07,0x00,0x00,0x1c,0x07,0x00,0x00,0x1c,0x03,0x80,0x00,0x1c,0x03,0x80,0x00,0x38,
+0x03,0xc0,0x00,0x38,0x01,0xc0,0x00,0x78,0x01,0xe0,0x00,0xf0,0x00,0xf0,0x01,0xe0,
+0x00,0x7e,0x07,0xc0,0x00,0x1f,0xff,0x80,0x00,0x07,0xfe,0x00,0x02,0x00,0x00,0x07,
+0xfe,0x00,0x0b,0x7f,0x00,0x00,0x03,0xff,0x00,0x00,0x07,0xe0,0x00,0x00,0x1f,0xfe,
+0x00,0x00,0x3c,0xfe,0x00,0x00,0x78,0xfe,0x00,0x00,0x70,0xfe,0x00,0x13,0xe0,0x00,
+0x00,0x01,0xc0,0x00,0x00,0x01,0xc0,0x00,0x00,0x03,0x80,0x00,0x00,0x03,0x80,0x00,
+0x00,0x03,0xfe,0x00,0x00,0x07,0xfe,0x00,0x6f,0x07,0x01,0xf0,0x00,0x07,0x0f,0xfe,
+0x00,0x06,0x3f,0xff,0x80,0x0e,0x78,0x07,0xc0,0x0e,0xe0,0x01,0xe0,0x0f,0xc0,0x00,
+0xf0,0x0f,0x80,0x00,0x70,0x0f,0x00,0x00,0x78,0x0f,0x00,0x00,0x38,0x0e,0x00,0x00,
+0x38,0x0e,0x00,0x00,0x1c,0x0e,0x00,0x00,0x1c,0x0e,0x00,0x00,0x1c,0x0e,0x00,0x00,
+0x1c,0x0e,0x00,0x00,0x1c,0x0e,0x00,0x00,0x1c,0x0e,0x00,0x00,0x1c,0x07,0x00,0x00,
+0x1c,0x07,0x00,0x00,0x38,0x07,0x00,0x00,0x38,0x03,0x80,0x00,0x38,0x03,0x80,0x00,
+0x70,0x01,0xc0,0x00,0xf0,0x01,0xe0,0x01,0xe0,0x00,0xf8,0x03,0xc0,0x00,0x7e,0x0f,
+0x80,0x00,0x1f,0xff,0x00,0x00,0x07,0xfc,0x00,0x07,0x1f,0xff,0xff,0xfc,0x1f,0xff,
+0xff,0xfc,0xfe,0x00,0x00,0x18,0xfe,0x00,0x00,0x38,0xfe,0x00,0x00,0x38,0xfe,0x00,
+0x00,0x70,0xfe,0x00,0x00,0x70,0xfe,0x00,0x00,0xe0,0xfe,0x00,0x00,0xe0,0xfe,0x00,
+0x13,0xc0,0x00,0x00,0x01,0xc0,0x00,0x00,0x01,0x80,0x00,0x00,0x03,0x80,0x00,0x00,
+0x03,0x80,0x00,0x00,0x07,0xfe,0x00,0x00,0x07,0xfe,0x00,0x00,0x0e,0xfe,0x00,0x00,
+0x0e,0xfe,0x00,0x00,0x1c,0xfe,0x00,0x00,0x1c,0xfe,0x00,0x00,0x38,0xfe,0x00,0x00,
+0x38,0xfe,0x00,0x00,0x38,0xfe,0x00,0x00,0x70,0xfe,0x00,0x00,0x70,0xfe,0x00,0x00,
+0xe0,0xfe,0x00,0x13,0xe0,0x00,0x00,0x01,0xc0,0x00,0x00,0x01,0xc0,0x00,0x00,0x03,
+0x80,0x00,0x00,0x03,0x80,0x00,0x00,0x07,0xfe,0x00,0x00,0x07,0xfe,0x00,0x00,0x07,
+0xfe,0x00,0x00,0x0e,0xfe,0x00,0x00,0x0e,0xfe,0x00,0x00,0x1c,0xfe,0x00,0x00,0x1c,
+0xfe,0x00,0x00,0x38,0xfe,0x00,0x00,0x38,0xfe,0x00,0x00,0x70,0xfe,0x00,0x02,0x70,
+0x00,0x00,0x7f,0x00,0x07,0xf0,0x00,0x00,0x3f,0xfe,0x00,0x00,0x7f,0x7f,0x80,0x01,
+0xf0,0x07,0xc0,0x03,0xe0,0x01,0xe0,0x03,0xc0,0x00,0xe0,0x07,0x80,0x00,0xf0,0x07,
+0x00,0x00,0x70,0x07,0x00,0x00,0x78,0x07,0x00,0x00,0x38,0x06,0x00,0x00,0x38,0x0e,
+0x00,0x00,0x38,0x07,0x00,0x00,0x38,0x07,0x00,0x00,0x38,0x07,0x00,0x00,0x70,0x07,
+0x00,0x00,0x70,0x03,0x80,0x00,0xe0,0x01,0xc0,0x01,0xe0,0x01,0xe0,0x03,0xc0,0x00,
+0x7c,0x0f,0x80,0x00,0x3f,0xfe,0x00,0x00,0x1f,0xfc,0x00,0x00,0x7e,0x1f,0x80,0x01,
+0xe0,0x03,0xc0,0x03,0xc0,0x01,0xe0,0x07,0x80,0x00,0x70,0x07,0x00,0x00,0x78,0x0e,
+0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,0x1c,0x1c,0x00,0x00,0x1c,0x1c,
+0x00,0x00,0x1c,0x2b,0x1c,0x00,0x00,0x1c,0x0c,0x00,0x00,0x1c,0x0e,0x00,0x00,0x1c,
+0x0e,0x00,0x00,0x38,0x0f,0x00,0x00,0x38,0x07,0x00,0x00,0x78,0x07,0x80,0x00,0xf0,
+0x03,0xe0,0x01,0xe0,0x01,0xf8,0x0f,0xc0,0x00,0x7f,0xff,0x00,0x00,0x1f,0xfc,0x00,
+0x73,0x00,0x0f,0xf0,0x00,0x00,0x3f,0xfc,0x00,0x00,0xff,0xff,0x00,0x01,0xf0,0x0f,
+0x80,0x03,0xc0,0x03,0xc0,0x03,0x80,0x01,0xc0,0x07,0x80,0x00,0xe0,0x07,0x00,0x00,
+0xe0,0x0e,0x00,0x00,0x70,0x0e,0x00,0x00,0x70,0x0e,0x00,0x00,0x70,0x0c,0x00,0x00,
+0x38,0x1c,0x00,0x00,0x38,0x1c,0x00,0x00,0x38,0x1c,0x00,0x00,0x38,0x1c,0x00,0x00,
+0x38,0x1c,0x00,0x00,0x38,0x1c,0x00,0x00,0x38,0x0e,0x00,0x00,0x38,0x0e,0x00,0x00,
+0x38,0x0e,0x00,0x00,0x78,0x07,0x00,0x00,0x78,0x07,0x80,0x00,0xf8,0x03,0x80,0x01,
+0xf8,0x03,0xc0,0x07,0xb8,0x01,0xf0,0x0f,0x38,0x00,0xff,0xfc,0x38,0x00,0x3f,0xf8,
+0x38,0x00,0x07,0x80,0x30,0xfe,0x00,0x00,0x70,0xfe,0x00,0x00,0x70,0xfe,0x00,0x00,
+0x60,0xfe,0x00,0x00,0xe0,0xfe,0x00,0x0f,0xe0,0x00,0x00,0x01,0xc0,0x00,0x00,0x03,
+0xc0,0x00,0x00,0x07,0x80,0x00,0x00,0x0f,0xfe,0x00,0x00,0x1e,0xfe,0x00,0x0d,0xfc,
+0x00,0x00,0x1f,0xf0,0x00,0x00,0x7f,0xc0,0x00,0x00,0x7e,0x00,0x00,0x29,0x07,0xf0,
+0x0f,0xfc,0x1f,0xfc,0x3e,0x3e,0x3c,0x1e,0x3c,0x1f,0x3c,0x1f,0x3c,0x1f,0x3c,0x1f,
+0x3c,0x1f,0x3c,0x1f,0x3c,0x1f,0x3c,0x1f,0x3c,0x1f,0x3c,0x1f,0x3c,0x1e,0x3e,0x1e,
+0x1f,0x3e,0x1f,0xfc,0x0f,0xf8,0x03,0xf0,0x29,0x00,0x30,0x01,0xf0,0x0f,0xf0,0x1f,
+0xf0,0x1f,0xf0,0x18,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,
+0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,
+0xf0,0x00,0xf0,0x29,0x07,0xf8,0x1f,0xfc,0x3f,0xfe,0x3e,0x3e,0x7c,0x1e,0x7c,0x1e,
+0x00,0x1e,0x00,0x1e,0x00,0x3e,0x00,0x7c,0x00,0x78,0x00,0xf8,0x01,0xf0,0x03,0xe0,
+0x07,0xc0,0x0f,0x80,0x1f,0x00,0x3f,0xff,0x3f,0xff,0x3f,0xff,0x3f,0xff,0x29,0x0f,
+0xf8,0x1f,0xfc,0x3f,0xfe,0x3e,0x3e,0x7c,0x1e,0x00,0x1f,0x00,0x1e,0x00,0x1e,0x00,
+0xfc,0x03,0xf8,0x03,0xf8,0x03,0xfc,0x00,0x1e,0x00,0x1f,0x00,0x1f,0x78,0x1f,0x7c,
+0x1f,0x3e,0x3e,0x3f,0xfe,0x1f,0xfc,0x07,0xf0,0x14,0x00,0x7c,0x00,0x7c,0x00,0xfc,
+0x01,0xfc,0x01,0xfc,0x03,0xfc,0x07,0xbc,0x07,0x3c,0x0f,0x3c,0x0e,0x3c,0x1e,0xfc,
+0x3c,0x0f,0x7f,0xff,0x7f,0xff,0x7f,0xff,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,
+0x00,0x3c,0x29,0x1f,0xfe,0x1f,0xfe,0x1f,0xfe,0x1e,0x00,0x1e,0x00,0x3c,0x00,0x3c,
+0x00,0x3c,0xf0,0x3f,0xfc,0x3f,0xfe,0x1c,0x3e,0x00,0x1e,0x00,0x1f,0x00,0x1f,0x00,
+0x1f,0x3c,0x1f,0x3c,0x1e,0x3f,0x3e,0x1f,0xfc,0x0f,0xf8,0x03,0xe0,0x29,0x00,0xf8,
+0x03,0xf8,0x07,0xf8,0x0f,0xc0,0x1f,0x00,0x1e,0x00,0x3e,0x00,0x3c,0xf8,0x3f,0xfc,
+0x3f,0xfe,0x3e,0x3f,0x3c,0x1f,0x3c,0x0f,0x3c,0x0f,0x3c,0x0f,0x3c,0x0f,0x3e,0x1f,
+0x1f,0x3e,0x1f,0xfe,0x0f,0xfc,0x03,0xf0,0x29,0x7f,0xff,0x7f,0xff,0x7f,0xff,0x00,
+0x1e,0x00,0x1e,0x00,0x3c,0x00,0x3c,0x00,0x7c,0x00,0x78,0x00,0xf8,0x00,0xf0,0x00,
+0xf0,0x01,0xe0,0x01,0xe0,0x03,0xe0,0x03,0xc0,0x07,0xc0,0x07,0x80,0x0f,0x80,0x0f,
+0x80,0x1f,0x00,0x05,0x07,0xf8,0x1f,0xfc,0x1f,0xfe,0xfe,0x3e,0x20,0x1e,0x3c,0x1e,
+0x3c,0x1e,0x3e,0x3e,0x1f,0xfc,0x0f,0xf8,0x0f,0xf8,0x1f,0xfc,0x3e,0x1e,0x3c,0x1f,
+0x3c,0x1f,0x3c,0x1f,0x3c,0x1f,0x3f,0x3e,0x1f,0xfe,0x0f,0xfc,0x07,0xf0,0x29,0x07,
+0xf0,0x0f,0xf8,0x1f,0xfc,0x3e,0x3e,0x3c,0x1e,0x3c,0x1e,0x7c,0x1f,0x7c,0x1f,0x3c,
+0x1f,0x3c,0x1f,0x3e,0x3f,0x1f,0xff,0x0f,0xfe,0x07,0x9e,0x00,0x1e,0x00,0x3e,0x00,
+0x7c,0x03,0xf8,0x07,0xf0,0x07,0xe0,0x07,0x00,0xfe,0x00,0x00,0x0f,0xf9,0x00,0x00,
+0x1f,0xf9,0x00,0x00,0x1f,0xf9,0x00,0x00,0x0f,0xea,0x00,0x2e,0x3c,0x78,0x78,0x0f,
+0x0f,0x1e,0x00,0xf8,0x00,0x3d,0xfc,0xfe,0x0f,0x0f,0x7f,0x03,0xfe,0x00,0x3f,0xff,
+0xfe,0x0f,0x0f,0xff,0x87,0xff,0x00,0x3f,0x7f,0xbf,0x0f,0x0f,0xdf,0x87,0x8f,0x80,
+0x3c,0x3e,0x1f,0x0f,0x0f,0x07,0x8f,0x07,0x80,0x3c,0x1e,0xfe,0x0f,0x05,0x07,0x8f,
+0x80,0x00,0x3c,0x1e,0xfe,0x0f,0x05,0x07,0x87,0xe0,0x00,0x3c,0x1e,0xfe,0x0f,0x05,
+0x07,0x87,0xfc,0x00,0x3c,0x1e,0xfe,0x0f,0x05,0x07,0x81,0xff,0x00,0x3c,0x1e,0xfe,
+0x0f,0x05,0x07,0x80,0x3f,0x80,0x3c,0x1e,0xfe,0x0f,0x05,0x07,0x80,0x0f,0x80,0x3c,
+0x1e,0xfe,0x0f,0x05,0x07,0x8f,0x07,0x80,0x3c,0x1e,0xfe,0x0f,0x05,0x07,0x8f,0x87,
+0x80,0x3c,0x1e,0xfe,0x0f,0x05,0x07,0x87,0xff,0x80,0x3c,0x1e,0xfe,0x0f,0x05,0x07,
+0x83,0xff,0x00,0x3c,0x1e,0xfe,0x0f,0x03,0x07,0x80,0xfc,0x00,0x01,0x07,0xf8,0x11,
+0x03,0xf0,0x07,0xf8,0x0f,0xfc,0x0f,0xfc,0x0f,0xfc,0x0f,0xfc,0x0f,0xfc,0x07,0xf8,
+0x03,0xe0,0xe5,0x00,0x11,0x03,0xf0,0x07,0xf8,0x0f,0xfc,0x0f,0xfc,0x0f,0xfc,0x0f,
+0xfc,0x0f,0xfc,0x07,0xf8,0x03,0xe0,0xfd,0x07,0xea,0x00,0xfe,0x0f,0x00,0x0e,0xfe,
+0x3e,0x00,0x1c,0xf9,0x00,0xfe,0x3e,0x00,0x1c,0x01,0x07,0xfc,0xf7,0x00,0x06,0x0f,
+0xfe,0x07,0x80,0x00,0x00,0xf0,0xfc,0x00,0x06,0x1f,0xff,0x07,0xc0,0x00,0x01,0xf0,
+0xfc,0x00,0x06,0x3f,0x1f,0x87,0xc0,0x00,0x01,0xf0,0xfc,0x00,0x06,0x3e,0x0f,0x87,
+0xc0,0x00,0x01,0xf0,0xfc,0x00,0x45,0x3c,0x07,0x9f,0xf0,0x3f,0x03,0xfc,0x78,0x3c,
+0x07,0xe0,0x3c,0x3e,0x00,0x1f,0xf0,0xff,0xc7,0xfc,0x78,0x3e,0x1f,0xf8,0x3c,0x3f,
+0x00,0x1f,0xf1,0xff,0xc7,0xfc,0x78,0x3e,0x3f,0xfc,0x3c,0x1f,0xe0,0x07,0xc1,0xe3,
+0xe1,0xf0,0x78,0x3e,0x3c,0x7c,0x18,0x0f,0xf8,0x07,0xc3,0xe1,0xe1,0xf0,0x78,0x3e,
+0x3c,0x3c,0x00,0x07,0xfe,0x07,0xc0,0x01,0xe1,0xf0,0x78,0x3e,0x3c,0xfe,0x00,0x08,
+0xff,0x07,0xc0,0x03,0xe1,0xf0,0x78,0x3e,0x3f,0xfe,0x00,0x6a,0x3f,0x87,0xc0,0xff,
+0xe1,0xf0,0x78,0x3e,0x1f,0xf0,0x00,0x00,0x0f,0x87,0xc1,0xff,0xe1,0xf0,0x78,0x3e,
+0x0f,0xf8,0x00,0x7c,0x07,0x87,0xc3,0xe1,0xe1,0xf0,0x78,0x3e,0x01,0xfc,0x00,0x7c,
+0x07,0x87,0xc3,0xc1,0xe1,0xf0,0x78,0x3e,0x00,0x3c,0x00,0x3e,0x0f,0x87,0xc3,0xc1,
+0xe1,0xf0,0x78,0x3e,0x78,0x3c,0x00,0x3f,0x1f,0x87,0xe3,0xe3,0xe0,0xf8,0x7c,0x7e,
+0x7c,0x3c,0x3c,0x1f,0xff,0x03,0xf3,0xff,0xe0,0xfe,0x7f,0xfe,0x3f,0xfc,0x3c,0x0f,
+0xfe,0x03,0xf1,0xff,0xf0,0xfe,0x3f,0xfe,0x1f,0xf8,0x3c,0x01,0xf8,0x01,0xf0,0x79,
+0xf0,0x3e,0x1f,0x3e,0x07,0xe0,0x18,0x01,0x3f,0xf8,0xfb,0x00,0x7f,0x3f,0xff,0x00,
+0x00,0x03,0xc0,0xf0,0x00,0x3f,0xff,0x80,0x00,0x03,0xc0,0xf0,0x00,0x3e,0x1f,0x80,
+0x00,0x03,0xc0,0xf0,0x00,0x3c,0x0f,0x80,0x00,0x03,0xc0,0xf0,0x00,0x3c,0x07,0x80,
+0x7c,0x0f,0xfb,0xfe,0x3c,0x3c,0x07,0x83,0xff,0x0f,0xfb,0xfe,0x3e,0x3c,0x0f,0x87,
+0xff,0x8f,0xfb,0xfe,0x3c,0x3e,0x1f,0x07,0xcf,0x87,0xc0,0xf8,0x1c,0x3f,0xfe,0x07,
+0x87,0x83,0xc0,0xf0,0x00,0x3f,0xfe,0x00,0x07,0xc3,0xc0,0xf0,0x00,0x3f,0xff,0x80,
+0x07,0xc3,0xc0,0xf0,0x00,0x3c,0x07,0x81,0xff,0xc3,0xc0,0xf0,0x00,0x3c,0x07,0xc7,
+0xff,0xc3,0xc0,0xf0,0x00,0x3c,0x07,0xc7,0x87,0xc3,0xc0,0xf0,0x00,0x3c,0x07,0xcf,
+0x87,0xc3,0xc0,0xf0,0x00,0x3c,0x0f,0xcf,0x87,0xc3,0xc0,0xf0,0x00,0x1f,0x3f,0xff,
+0x8f,0x8f,0xc3,0xe0,0xf8,0x3c,0x3f,0xff,0x87,0xff,0xc3,0xf8,0xfe,0x3e,0x3f,0xfe,
+0x07,0xff,0xc1,0xf8,0x7e,0x3c,0x3f,0xf8,0x01,0xf3,0xc0,0xf8,0x3e,0x1c,0x3e,0x1f,
+0x80,0x00,0x3f,0xc0,0x00,0x39,0xc1,0x00,0x30,0xc3,0x80,0x30,0xe3,0x00,0x30,0xc6,
+0x00,0x39,0xce,0x00,0x3f,0xcc,0x00,0x0f,0x1c,0x00,0x00,0x38,0x00,0x00,0x30,0x00,
+0x00,0x70,0x00,0x00,0x67,0xe0,0x00,0xcf,0xf0,0x01,0xce,0x30,0x01,0x8c,0x38,0x03,
+0x8c,0x38,0x07,0x0c,0x38,0x02,0x0e,0x70,0x00,0x07,0xf0,0x00,0x03,0xe0,0x02,0x00,
+0x03,0xfc,0xec,0x00,0x02,0x1f,0xff,0x80,0xed,0x00,0x02,0x7f,0xff,0xe0,0xee,0x00,
+0x05,0x01,0xf8,0x01,0xf8,0x00,0x38,0xf0,0x00,0x05,0x03,0xe0,0x00,0x7c,0x00,0x38,
+0xf0,0x00,0x05,0x03,0xc0,0x00,0x1c,0x00,0x38,0xf0,0x00,0x05,0x07,0x80,0x00,0x0e,
+0x00,0x38,0xf0,0x00,0x05,0x07,0x00,0x00,0x0f,0x00,0x38,0xf0,0x00,0x05,0x0f,0x00,
+0x00,0x07,0x00,0x38,0xf0,0x00,0x05,0x0e,0x00,0x00,0x07,0x00,0x38,0xf0,0x00,0x05,
+0x0e,0x00,0x00,0x07,0x00,0x38,0xf0,0x00,0x05,0x0e,0x00,0x00,0x07,0x80,0x3c,0xfb,
+0x00,0x05,0x0f,0xe0,0x00,0x00,0x07,0xf8,0xfe,0x00,0x02,0xfe,0x00,0x0f,0xfe,0x00,
+0x13,0x0f,0xff,0xf0,0x1c,0x00,0x00,0xe0,0x00,0x7f,0xf8,0x70,0x00,0x3f,0xff,0x00,
+0x03,0x83,0xff,0xc0,0x07,0xfe,0x00,0x13,0x0f,0xff,0xf0,0x1c,0x00,0x00,0xe0,0x00,
+0xff,0xfe,0x70,0x00,0x7e,0x3f,0x80,0x03,0x8f,0xff,0xe0,0x07,0xfd,0x00,0x13,0x38,
+0x00,0x1c,0x00,0x00,0xe0,0x01,0xf0,0x0f,0x70,0x01,0xf0,0x03,0xc0,0x03,0x9e,0x01,
+0xf0,0x07,0x80,0xfe,0x00,0x13,0x38,0x00,0x1c,0x00,0x00,0xe0,0x03,0xc0,0x03,0x70,
+0x01,0xc0,0x01,0xe0,0x03,0xb8,0x00,0xf0,0x03,0xc0,0xfe,0x00,0x13,0x38,0x00,0x1c,
+0x00,0x00,0xe0,0x03,0x80,0x01,0xf0,0x03,0x80,0x00,0xe0,0x03,0xf0,0x00,0x78,0x01,
+0xf0,0xfe,0x00,0x13,0x38,0x00,0x1c,0x00,0x00,0xe0,0x07,0x00,0x00,0xf0,0x07,0x80,
+0x00,0xf0,0x03,0xe0,0x00,0x38,0x00,0xfc,0xfe,0x00,0x37,0x38,0x00,0x1c,0x00,0x00,
+0xe0,0x07,0x00,0x00,0xf0,0x07,0x00,0x00,0x70,0x03,0xc0,0x00,0x38,0x00,0x3f,0x80,
+0x00,0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,0x0e,0x00,0x00,0x70,0x07,0x00,0x00,0x70,
+0x03,0xc0,0x00,0x38,0x00,0x0f,0xf8,0x00,0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,0x0e,
+0x00,0x00,0x70,0xfe,0x00,0x13,0x70,0x03,0x80,0x00,0x38,0x00,0x03,0xff,0x00,0x00,
+0x38,0x00,0x1c,0x00,0x00,0xe0,0x0e,0x00,0x00,0x70,0xfe,0x00,0x13,0x70,0x03,0x80,
+0x00,0x38,0x00,0x00,0x7f,0xc0,0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,0x0e,0x00,0x00,
+0x70,0xfe,0x00,0x13,0x70,0x03,0x80,0x00,0x18,0x00,0x00,0x07,0xf0,0x00,0x38,0x00,
+0x1c,0x00,0x00,0xe0,0x1c,0x00,0x00,0x70,0xfe,0x00,0x13,0x70,0x03,0x80,0x00,0x18,
+0x00,0x00,0x01,0xf8,0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,0x1c,0x00,0x00,0x70,0xfe,
+0x00,0x04,0x70,0x03,0x80,0x00,0x18,0xfe,0x00,0x13,0x7c,0x00,0x38,0x00,0x1c,0x00,
+0x00,0xe0,0x1c,0x00,0x00,0x70,0x00,0x07,0xff,0xf0,0x03,0x80,0x00,0x18,0xfe,0x00,
+0x13,0x1e,0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,0x1c,0x00,0x00,0x70,0x00,0x3f,0xff,
+0xf0,0x03,0x80,0x00,0x18,0xfe,0x00,0x13,0x0f,0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,
+0x1c,0x00,0x00,0x70,0x00,0xfc,0x00,0x70,0x03,0x80,0x00,0x18,0xfe,0x00,0x13,0x07,
+0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,0x1c,0x00,0x00,0x70,0x01,0xe0,0x00,0x70,0x03,
+0x80,0x00,0x18,0xfe,0x00,0x13,0x07,0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,0x1c,0x00,
+0x00,0x70,0x03,0xc0,0x00,0x70,0x03,0x80,0x00,0x18,0xfe,0x00,0x7f,0x03,0x80,0x38,
+0x00,0x1c,0x00,0x00,0xe0,0x1c,0x00,0x00,0x70,0x07,0x80,0x00,0x70,0x03,0x80,0x00,
+0x18,0x1c,0x00,0x00,0x03,0x80,0x38,0x00,0x1c,0x00,0x00,0xe0,0x0e,0x00,0x00,0x70,
+0x07,0x00,0x00,0x70,0x03,0x80,0x00,0x18,0x1c,0x00,0x00,0x03,0x80,0x38,0x00,0x0c,
+0x00,0x00,0xe0,0x0e,0x00,0x00,0x70,0x0e,0x00,0x00,0x70,0x03,0x80,0x00,0x18,0x1c,
+0x00,0x00,0x03,0x80,0x38,0x00,0x0e,0x00,0x00,0xe0,0x0e,0x00,0x00,0x70,0x0e,0x00,
+0x00,0x70,0x03,0x80,0x00,0x18,0x1e,0x00,0x00,0x03,0x80,0x38,0x00,0x0e,0x00,0x00,
+0xe0,0x0e,0x00,0x00,0x70,0x0e,0x00,0x00,0x70,0x03,0x80,0x00,0x18,0x0e,0x00,0x00,
+0x07,0x00,0x38,0x00,0x0e,0x00,0x01,0xe0,0x07,0x00,0x00,0x70,0x0e,0x7f,0x00,0x00,
+0xf0,0x03,0x80,0x00,0x18,0x0f,0x00,0x00,0x07,0x00,0x38,0x00,0x0e,0x00,0x01,0xe0,
+0x07,0x00,0x00,0xf0,0x0f,0x00,0x00,0xf0,0x03,0x80,0x00,0x18,0x07,0x80,0x00,0x0f,
+0x00,0x38,0x00,0x0f,0x00,0x03,0xe0,0x03,0x80,0x01,0xf0,0x07,0x00,0x01,0xf0,0x03,
+0x80,0x00,0x18,0x03,0xc0,0x00,0x1e,0x00,0x1c,0x00,0x07,0x00,0x07,0xe0,0x03,0xc0,
+0x03,0xf0,0x07,0x80,0x03,0xf0,0x03,0x80,0x00,0x18,0x01,0xf0,0x00,0x7c,0x00,0x1c,
+0x00,0x07,0xc0,0x0e,0xe0,0x01,0xe0,0x07,0x70,0x03,0xc0,0x0f,0x70,0x03,0x80,0x00,
+0x18,0x00,0xfe,0x03,0xf8,0x00,0x1f,0x00,0x03,0xf0,0x7c,0xe0,0x00,0xf8,0x3e,0x70,
+0x01,0xf0,0x7e,0x70,0x03,0x80,0x00,0x18,0x00,0x3f,0xff,0xe0,0x00,0x0f,0x27,0xf0,
+0x01,0xff,0xf8,0xe0,0x00,0x7f,0xfc,0x70,0x00,0xff,0xf8,0x78,0x03,0x80,0x00,0x18,
+0x00,0x07,0xff,0x80,0x00,0x07,0xf0,0x00,0x7f,0xe0,0xe0,0x00,0x1f,0xf0,0x70,0x00,
+0x3f,0xe0,0x38,0x03,0x80,0x00,0x18,0xf3,0x00,0x00,0x70,0xeb,0x00,0x00,0x70,0xeb,
+0x00,0x00,0x70,0xeb,0x00,0x00,0x70,0xeb,0x00,0x00,0xe0,0xeb,0x00,0x00,0xe0,0xee,
+0x00,0x03,0x03,0x00,0x01,0xe0,0xee,0x00,0x03,0x07,0x80,0x03,0xc0,0xee,0x00,0x03,
+0x03,0xc0,0x07,0x80,0xee,0x00,0x02,0x01,0xf8,0x1f,0xec,0x00,0x01,0x7f,0xfe,0xec,
+0x00,0x01,0x1f,0xf8,0xf8,0x00,0x00,0x3f,0xfe,0xff,0x00,0xc0,0xf0,0x00,0x00,0x3f,
+0xfe,0xff,0x00,0xc0,0xee,0x00,0x00,0xf0,0xf0,0x00,0x00,0x70,0xfe,0x00,0x00,0xe0,
+0xf0,0x00,0x00,0x70,0xfe,0x00,0x00,0xe0,0xf0,0x00,0x00,0x70,0xfe,0x00,0x00,0xe0,
+0xf0,0x00,0x00,0x70,0xfe,0x00,0x00,0xe0,0xf0,0x00,0x00,0x70,0xfe,0x00,0x00,0xe0,
+0xf0,0x00,0x00,0x70,0xfe,0x00,0x00,0xe0,0xf0,0x00,0x00,0x70,0xfe,0x00,0x00,0xe0,
+0xf0,0x00,0x00,0x70,0xfe,0x00,0x00,0xe0,0xfe,0x00,0x00,0x7f,0xfe,0x00,0x03,0x1f,
+0x00,0x03,0xf8,0xfe,0x00,0x03,0xfe,0x00,0x00,0xf0,0xfe,0x00,0x3e,0xe0,0x00,0x00,
+0x03,0xff,0xe0,0x00,0x38,0x7f,0x00,0x1f,0xfe,0x1c,0x00,0x07,0xff,0x80,0x1f,0xff,
+0xc0,0x00,0x00,0xe0,0x00,0x00,0x07,0xf3,0xf8,0x00,0x38,0xff,0x00,0x3f,0xff,0x9c,
+0x00,0x0f,0xcf,0xe0,0x1f,0xff,0xc0,0x00,0x00,0xe0,0x00,0x00,0x1f,0x00,0x7c,0x00,
+0x39,0xe0,0x00,0x7c,0x03,0xdc,0x00,0x1e,0x01,0xf0,0x00,0x70,0xfe,0x00,0x12,0xe0,
+0x00,0x00,0x3c,0x00,0x1e,0x00,0x3b,0x80,0x00,0xf0,0x00,0xdc,0x00,0x38,0x00,0x78,
+0x00,0x70,0xfe,0x00,0x12,0xe0,0x00,0x00,0x38,0x00,0x0e,0x00,0x3f,0x00,0x00,0xe0,
+0x00,0x7c,0x00,0x70,0x00,0x38,0x00,0x70,0xfe,0x00,0x12,0xe0,0x00,0x00,0x70,0x00,
+0x07,0x00,0x3e,0x00,0x01,0xc0,0x00,0x3c,0x00,0xe0,0x00,0x1c,0x00,0x70,0xfe,0x00,
+0x12,0xe0,0x00,0x00,0xf0,0x00,0x07,0x80,0x3c,0x00,0x01,0xc0,0x00,0x3c,0x00,0xe0,
+0x00,0x1c,0x00,0x70,0xfe,0x00,0x12,0xe0,0x00,0x00,0xe0,0x00,0x03,0x80,0x3c,0x00,
+0x03,0x80,0x00,0x1c,0x01,0xc0,0x00,0x0e,0x00,0x70,0xfe,0x00,0x12,0xe0,0x00,0x00,
+0xe0,0x00,0x03,0x80,0x3c,0x00,0x03,0x80,0x00,0x1c,0x01,0xc0,0x00,0x0e,0x00,0x70,
+0xfe,0x00,0x12,0xe0,0x00,0x01,0xc0,0x00,0x01,0xc0,0x38,0x00,0x03,0x80,0x00,0x1c,
+0x01,0xc0,0x00,0x0e,0x00,0x70,0xfe,0x00,0x12,0xe0,0x00,0x01,0xc0,0x00,0x01,0xc0,
+0x38,0x00,0x03,0x80,0x00,0x1c,0x03,0x80,0x00,0x0e,0x00,0x70,0xfe,0x00,0x12,0xe0,
+0x00,0x01,0xc0,0x00,0x01,0xc0,0x38,0x00,0x07,0x00,0x00,0x1c,0x03,0x80,0x00,0x0e,
+0x00,0x70,0xfe,0x00,0x12,0xe0,0x00,0x01,0xc0,0x00,0x01,0xc0,0x38,0x00,0x07,0x00,
+0x00,0x1c,0x03,0x80,0x00,0x0e,0x00,0x70,0xfe,0x00,0x12,0xe0,0x00,0x01,0xc0,0x00,
+0x01,0xc0,0x38,0x00,0x07,0x00,0x00,0x1c,0x03,0xff,0xff,0xfe,0x00,0x70,0xfe,0x00,
+0x12,0xe0,0x00,0x01,0xc0,0x00,0x01,0xc0,0x38,0x00,0x07,0x00,0x00,0x1c,0x03,0xff,
+0xff,0xfe,0x00,0x70,0xfe,0x00,0x0e,0xe0,0x00,0x01,0xc0,0x00,0x01,0xc0,0x38,0x00,
+0x07,0x00,0x00,0x1c,0x03,0x80,0xfe,0x00,0x00,0x70,0xfe,0x00,0x0e,0xe0,0x00,0x01,
+0xc0,0x00,0x01,0xc0,0x38,0x00,0x07,0x00,0x00,0x1c,0x03,0x80,0xfe,0x00,0x00,0x70,
+0xfe,0x00,0x0e,0xe0,0x00,0x01,0xc0,0x00,0x01,0xc0,0x38,0x00,0x07,0x00,0x00,0x1c,
+0x03,0x80,0xfe,0x00,0x00,0x70,0xfe,0x00,0x0e,0xe0,0x00,0x01,0xc0,0x00,0x01,0xc0,
+0x38,0x00,0x07,0x00,0x00,0x1c,0x03,0x80,0xfe,0x00,0x00,0x70,0xfe,0x00,0x0e,0xe0,
+0x00,0x01,0xc0,0x00,0x01,0xc0,0x38,0x00,0x03,0x80,0x00,0x1c,0x03,0x80,0xfe,0x00,
+0x00,0x70,0xfe,0x00,0x0e,0xe0,0x00,0x01,0xc0,0x00,0x01,0xc0,0x38,0x00,0x03,0x80,
+0x00,0x1c,0x03,0x80,0xfe,0x00,0x00,0x70,0xfe,0x00,0x0e,0xe0,0x00,0x00,0xe0,0x00,
+0x03,0xc0,0x38,0x00,0x03,0x80,0x00,0x1c,0x01,0xc0,0xfe,0x00,0x00,0x70,0xfe,0x00,
+0x0e,0xe0,0x00,0x00,0xe0,0x00,0x03,0x80,0x38,0x00,0x03,0x80,0x00,0x1c,0x01,0xc0,
+0xfe,0x00,0x00,0x70,0xfe,0x00,0x0e,0xe0,0x00,0x00,0xf0,0x00,0x07,0x80,0x38,0x00,
+0x01,0xc0,0x00,0x1c,0x00,0xe0,0xfe,0x00,0x00,0x70,0xfe,0x00,0x0e,0xe0,0x00,0x00,
+0x70,0x00,0x07,0x00,0x38,0x00,0x01,0xc0,0x00,0x3c,0x00,0xf0,0xfe,0x00,0x00,0x70,
+0xfe,0x00,0x12,0xe0,0x00,0x00,0x78,0x00,0x0f,0x00,0x38,0x00,0x00,0xe0,0x00,0x7c,
+0x00,0x70,0x00,0x0c,0x00,0x70,0xfe,0x00,0x12,0xe0,0x00,0x00,0x3c,0x00,0x1e,0x00,
+0x38,0x00,0x00,0xf0,0x00,0xfc,0x00,0x78,0x00,0x1c,0x00,0x70,0xfe,0x00,0x12,0xe0,
+0x00,0x00,0x1e,0x00,0x3c,0x00,0x38,0x00,0x00,0x78,0x01,0xdc,0x00,0x3e,0x00,0x38,
+0x00,0x78,0xfe,0x00,0x12,0xe0,0x00,0x00,0x0f,0xc1,0xf8,0x00,0x38,0x00,0x00,0x3e,
+0x0f,0x9c,0x00,0x1f,0x81,0xf0,0x00,0x3c,0xfe,0x00,0x16,0xe0,0x00,0x00,0x03,0xff,
+0xf0,0x00,0x38,0x00,0x00,0x1f,0xff,0x1c,0x00,0x07,0xff,0xe0,0x00,0x1f,0xe0,0x00,
+0x00,0xe0,0xfe,0x00,0x0f,0xff,0x80,0x00,0x38,0x00,0x00,0x07,0xfc,0x1c,0x00,0x01,
+0xff,0x80,0x00,0x0f,0xe0,0xf3,0x00,0x00,0x1c,0xec,0x00,0x00,0x1c,0xec,0x00,0x00,
+0x1c,0xec,0x00,0x00,0x1c,0xec,0x00,0x00,0x38,0xec,0x00,0x00,0x38,0xee,0x00,0x02,
+0xc0,0x00,0x78,0xef,0x00,0x03,0x01,0xe0,0x00,0xf0,0xee,0x00,0x02,0xf0,0x01,0xe0,
+0xee,0x00,0x02,0x7e,0x07,0xc0,0xee,0x00,0x02,0x1f,0xff,0x80,0xee,0x00,0x01,0x07,
+0xfe,0xf9,0x00,0xfc,0x00,0x00,0xe0,0xfa,0x00,0x00,0xe0,0xf4,0x00,0x00,0xe0,0xfa,
+0x00,0x00,0xe0,0xf8,0x00,0x04,0x03,0xfc,0x00,0x00,0xe0,0xfa,0x00,0x00,0xe0,0xf8,
+0x00,0x04,0x1f,0xff,0x80,0x00,0xe0,0xfa,0x00,0x00,0xe0,0xf8,0x00,0x04,0x7f,0xff,
+0xe0,0x00,0xe0,0xfa,0x00,0x00,0xe0,0xf9,0x00,0x05,0x01,0xf8,0x01,0xf8,0x00,0xe0,
+0xfa,0x00,0x00,0xe0,0xf9,0x00,0x05,0x03,0xe0,0x00,0x7c,0x00,0xe0,0xfa,0x00,0x00,
+0xe0,0xf9,0x00,0x05,0x03,0xc0,0x00,0x1c,0x00,0xe0,0xfa,0x00,0x00,0xe0,0xf9,0x00,
+0x05,0x07,0x80,0x00,0x0e,0x00,0xe0,0xfa,0x00,0x00,0xe0,0xf9,0x00,0x05,0x07,0x00,
+0x00,0x0f,0x00,0xe0,0xfa,0x00,0x00,0xe0,0xf9,0x00,0x05,0x0f,0x00,0x00,0x07,0x00,
+0xe0,0xfa,0x00,0x00,0xe0,0xf9,0x00,0x05,0x0e,0x00,0x00,0x07,0x00,0xe0,0xfa,0x00,
+0x00,0xe0,0xf9,0x00,0x05,0x0e,0x00,0x00,0x07,0x00,0xe0,0xfa,0x00,0x00,0xe0,0xf9,
+0x00,0x05,0x0e,0x00,0x00,0x07,0x80,0xe0,0xfe,0x00,0x0d,0x03,0xfc,0x00,0x00,0xe0,
+0x00,0x0f,0xf0,0x00,0x00,0x01,0xfc,0x00,0x0f,0xfd,0x00,0x11,0xe0,0x00,0x3c,0x00,
+0x1f,0xff,0x00,0x00,0xe0,0x00,0x7f,0xfe,0x00,0x07,0x07,0xff,0x80,0x07,0xfd,0x00,
+0x11,0xe0,0x00,0x78,0x00,0x3f,0x9f,0xc0,0x00,0xe0,0x00,0xfc,0x7f,0x00,0x07,0x1f,
+0xff,0xc0,0x07,0xfd,0x00,0x12,0xe0,0x00,0xf0,0x00,0x78,0x03,0xe0,0x00,0xe0,0x03,
+0xe0,0x07,0x80,0x07,0x3c,0x03,0xe0,0x07,0x80,0xfe,0x00,0x12,0xe0,0x01,0xe0,0x00,
+0xf0,0x00,0xf0,0x00,0xe0,0x03,0x80,0x03,0xc0,0x07,0x70,0x01,0xe0,0x03,0xc0,0xfe,
+0x00,0x12,0xe0,0x03,0xc0,0x01,0xe0,0x00,0x78,0x00,0xe0,0x07,0x00,0x01,0xc0,0x07,
+0xe0,0x00,0xf0,0x01,0xf0,0xfe,0x00,0x12,0xe0,0x07,0x80,0x03,0xc0,0x00,0x38,0x00,
+0xe0,0x0f,0x00,0x01,0xe0,0x07,0xc0,0x00,0x70,0x00,0xfc,0xfe,0x00,0x34,0xe0,0x0f,
+0x00,0x03,0x80,0x00,0x1c,0x00,0xe0,0x0e,0x00,0x00,0xe0,0x07,0x80,0x00,0x70,0x00,
+0x3f,0x80,0x00,0x00,0xe0,0x1e,0x00,0x07,0x00,0x00,0x1c,0x00,0xe0,0x0e,0x00,0x00,
+0xe0,0x07,0x80,0x00,0x70,0x00,0x0f,0xf8,0x00,0x00,0xe0,0x3c,0x00,0x07,0x00,0x00,
+0x0e,0x00,0xe0,0xfe,0x00,0x12,0xe0,0x07,0x00,0x00,0x70,0x00,0x03,0xff,0x00,0x00,
+0xe0,0x78,0x00,0x07,0x00,0x00,0x0e,0x00,0xe0,0xfe,0x00,0x12,0xe0,0x07,0x00,0x00,
+0x70,0x00,0x00,0x7f,0xc0,0x00,0xe0,0xf0,0x00,0x0e,0x00,0x00,0x0e,0x00,0xe0,0xfe,
+0x00,0x12,0xe0,0x07,0x00,0x00,0x30,0x00,0x00,0x07,0xf0,0x00,0xe1,0xe0,0x00,0x0e,
+0x00,0x00,0x0e,0x00,0xe0,0xfe,0x00,0x12,0xe0,0x07,0x00,0x00,0x30,0x00,0x00,0x01,
+0xf8,0x00,0xe3,0xc0,0x00,0x0e,0x00,0x00,0x06,0x00,0xe0,0xfe,0x00,0x04,0xe0,0x07,
+0x00,0x00,0x30,0xfe,0x00,0x12,0x7c,0x00,0xe7,0xc0,0x00,0x0e,0x00,0x00,0x07,0x00,
+0xe0,0x00,0x0f,0xff,0xe0,0x07,0x00,0x00,0x30,0xfe,0x00,0x12,0x1e,0x00,0xef,0xe0,
+0x00,0x0e,0x00,0x00,0x07,0x00,0xe0,0x00,0x7f,0xff,0xe0,0x07,0x00,0x00,0x30,0xfe,
+0x00,0x12,0x0f,0x00,0xfe,0xf0,0x00,0x0e,0x00,0x00,0x07,0x00,0xe0,0x01,0xf8,0x00,
+0xe0,0x07,0x00,0x00,0x30,0xfe,0x00,0x12,0x07,0x00,0xfc,0x78,0x00,0x0e,0x00,0x00,
+0x07,0x00,0xe0,0x03,0xc0,0x00,0xe0,0x07,0x00,0x00,0x30,0xfe,0x00,0x12,0x07,0x00,
+0xf8,0x3c,0x00,0x0e,0x00,0x00,0x07,0x00,0xe0,0x07,0x80,0x00,0xe0,0x07,0x00,0x00,
+0x30,0xfe,0x00,0x7f,0x03,0x80,0xf0,0x1c,0x00,0x0e,0x00,0x00,0x0e,0x00,0xe0,0x0f,
+0x00,0x00,0xe0,0x07,0x00,0x00,0x30,0x1c,0x00,0x00,0x03,0x80,0xe0,0x1e,0x00,0x0e,
+0x00,0x00,0x0e,0x00,0xe0,0x0e,0x00,0x00,0xe0,0x07,0x00,0x00,0x30,0x1c,0x00,0x00,
+0x03,0x80,0xe0,0x0f,0x00,0x07,0x00,0x00,0x0e,0x00,0xe0,0x1c,0x00,0x00,0xe0,0x07,
+0x00,0x00,0x30,0x1c,0x00,0x00,0x03,0x80,0xe0,0x07,0x80,0x07,0x00,0x00,0x0e,0x00,
+0xe0,0x1c,0x00,0x00,0xe0,0x07,0x00,0x00,0x30,0x1e,0x00,0x00,0x03,0x80,0xe0,0x03,
+0xc0,0x07,0x00,0x00,0x1c,0x00,0xe0,0x1c,0x00,0x00,0xe0,0x07,0x00,0x00,0x30,0x0e,
+0x00,0x00,0x07,0x00,0xe0,0x01,0xc0,0x03,0x80,0x00,0x1c,0x00,0xe0,0x1c,0x00,0x01,
+0xe0,0x07,0x00,0x00,0x7f,0x30,0x0f,0x00,0x00,0x07,0x00,0xe0,0x00,0xe0,0x03,0x80,
+0x00,0x3c,0x00,0xe0,0x1e,0x00,0x01,0xe0,0x07,0x00,0x00,0x30,0x07,0x80,0x00,0x0f,
+0x00,0xe0,0x00,0xf0,0x01,0xc0,0x00,0x78,0x00,0xe0,0x0e,0x00,0x03,0xe0,0x07,0x00,
+0x00,0x30,0x03,0xc0,0x00,0x1e,0x00,0xe0,0x00,0x78,0x01,0xe0,0x00,0xf0,0x00,0xe0,
+0x0f,0x00,0x07,0xe0,0x07,0x00,0x00,0x30,0x01,0xf0,0x00,0x7c,0x00,0xe0,0x00,0x3c,
+0x00,0xf8,0x01,0xe0,0x00,0xe0,0x07,0x80,0x1e,0xe0,0x07,0x00,0x00,0x30,0x00,0xfe,
+0x03,0xf8,0x00,0xe0,0x00,0x1c,0x00,0x7e,0x07,0xc0,0x00,0xe0,0x03,0xe0,0xfc,0xe0,
+0x07,0x00,0x00,0x30,0x00,0x3f,0xff,0xe0,0x00,0xe0,0x00,0x0e,0x00,0x1f,0xff,0x80,
+0x00,0xe0,0x01,0xff,0xf0,0x1a,0xf0,0x07,0x00,0x00,0x30,0x00,0x07,0xff,0x80,0x00,
+0xe0,0x00,0x0f,0x00,0x07,0xfe,0x00,0x00,0xe0,0x00,0x7f,0xc0,0x70,0x07,0x00,0x00,
+0x30
 };
-Element BATT{BATT_BYTE_WIDTH, BATT_ADVANCE, BATT_DATA};
-
-const int PERCENT_BYTE_WIDTH = 3;
-const int PERCENT_ADVANCE = 23;
-const unsigned char PERCENT_DATA[180] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0x00,0x3f,0xc0,
-0x00,0x39,0xc1,0x00,0x30,0xc3,0x80,0x30,0xe3,0x00,0x30,0xc6,0x00,0x39,0xce,0x00,
-0x3f,0xcc,0x00,0x0f,0x1c,0x00,0x00,0x38,0x00,0x00,0x30,0x00,0x00,0x70,0x00,0x00,
-0x67,0xe0,0x00,0xcf,0xf0,0x01,0xce,0x30,0x01,0x8c,0x38,0x03,0x8c,0x38,0x07,0x0c,
-0x38,0x02,0x0e,0x70,0x00,0x07,0xf0,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00};
-Element PERCENT{PERCENT_BYTE_WIDTH, PERCENT_ADVANCE, PERCENT_DATA};
-
-const int STUGAN_BYTE_WIDTH = 23;
-const int STUGAN_ADVANCE = 187;
-const unsigned char STUGAN_DATA[1380] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x80,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x7f,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x01,0xf8,0x00,0x38,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x03,0xe0,0x00,0x7c,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xc0,0x00,0x1c,0x00,0x38,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
-0x80,0x00,0x0e,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x0f,0x00,0x38,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,
-0x07,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x07,0x00,
-0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x0e,0x00,0x00,0x07,0x80,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xe0,
-0x00,0x00,0x07,0xf8,0x00,0x00,0x00,0xfe,0x00,0x0f,0x00,0x00,0x00,0x0f,0xff,0xf0,
-0x1c,0x00,0x00,0xe0,0x00,0x7f,0xf8,0x70,0x00,0x3f,0xff,0x00,0x03,0x83,0xff,0xc0,
-0x07,0x00,0x00,0x00,0x0f,0xff,0xf0,0x1c,0x00,0x00,0xe0,0x00,0xff,0xfe,0x70,0x00,
-0x7e,0x3f,0x80,0x03,0x8f,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x38,0x00,0x1c,0x00,
-0x00,0xe0,0x01,0xf0,0x0f,0x70,0x01,0xf0,0x03,0xc0,0x03,0x9e,0x01,0xf0,0x07,0x80,
-0x00,0x00,0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,0x03,0xc0,0x03,0x70,0x01,0xc0,0x01,
-0xe0,0x03,0xb8,0x00,0xf0,0x03,0xc0,0x00,0x00,0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,
-0x03,0x80,0x01,0xf0,0x03,0x80,0x00,0xe0,0x03,0xf0,0x00,0x78,0x01,0xf0,0x00,0x00,
-0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,0x07,0x00,0x00,0xf0,0x07,0x80,0x00,0xf0,0x03,
-0xe0,0x00,0x38,0x00,0xfc,0x00,0x00,0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,0x07,0x00,
-0x00,0xf0,0x07,0x00,0x00,0x70,0x03,0xc0,0x00,0x38,0x00,0x3f,0x80,0x00,0x00,0x38,
-0x00,0x1c,0x00,0x00,0xe0,0x0e,0x00,0x00,0x70,0x07,0x00,0x00,0x70,0x03,0xc0,0x00,
-0x38,0x00,0x0f,0xf8,0x00,0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,0x0e,0x00,0x00,0x70,
-0x00,0x00,0x00,0x70,0x03,0x80,0x00,0x38,0x00,0x03,0xff,0x00,0x00,0x38,0x00,0x1c,
-0x00,0x00,0xe0,0x0e,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x03,0x80,0x00,0x38,0x00,
-0x00,0x7f,0xc0,0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,0x0e,0x00,0x00,0x70,0x00,0x00,
-0x00,0x70,0x03,0x80,0x00,0x18,0x00,0x00,0x07,0xf0,0x00,0x38,0x00,0x1c,0x00,0x00,
-0xe0,0x1c,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x03,0x80,0x00,0x18,0x00,0x00,0x01,
-0xf8,0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,0x1c,0x00,0x00,0x70,0x00,0x00,0x00,0x70,
-0x03,0x80,0x00,0x18,0x00,0x00,0x00,0x7c,0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,0x1c,
-0x00,0x00,0x70,0x00,0x07,0xff,0xf0,0x03,0x80,0x00,0x18,0x00,0x00,0x00,0x1e,0x00,
-0x38,0x00,0x1c,0x00,0x00,0xe0,0x1c,0x00,0x00,0x70,0x00,0x3f,0xff,0xf0,0x03,0x80,
-0x00,0x18,0x00,0x00,0x00,0x0f,0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,0x1c,0x00,0x00,
-0x70,0x00,0xfc,0x00,0x70,0x03,0x80,0x00,0x18,0x00,0x00,0x00,0x07,0x00,0x38,0x00,
-0x1c,0x00,0x00,0xe0,0x1c,0x00,0x00,0x70,0x01,0xe0,0x00,0x70,0x03,0x80,0x00,0x18,
-0x00,0x00,0x00,0x07,0x00,0x38,0x00,0x1c,0x00,0x00,0xe0,0x1c,0x00,0x00,0x70,0x03,
-0xc0,0x00,0x70,0x03,0x80,0x00,0x18,0x00,0x00,0x00,0x03,0x80,0x38,0x00,0x1c,0x00,
-0x00,0xe0,0x1c,0x00,0x00,0x70,0x07,0x80,0x00,0x70,0x03,0x80,0x00,0x18,0x1c,0x00,
-0x00,0x03,0x80,0x38,0x00,0x1c,0x00,0x00,0xe0,0x0e,0x00,0x00,0x70,0x07,0x00,0x00,
-0x70,0x03,0x80,0x00,0x18,0x1c,0x00,0x00,0x03,0x80,0x38,0x00,0x0c,0x00,0x00,0xe0,
-0x0e,0x00,0x00,0x70,0x0e,0x00,0x00,0x70,0x03,0x80,0x00,0x18,0x1c,0x00,0x00,0x03,
-0x80,0x38,0x00,0x0e,0x00,0x00,0xe0,0x0e,0x00,0x00,0x70,0x0e,0x00,0x00,0x70,0x03,
-0x80,0x00,0x18,0x1e,0x00,0x00,0x03,0x80,0x38,0x00,0x0e,0x00,0x00,0xe0,0x0e,0x00,
-0x00,0x70,0x0e,0x00,0x00,0x70,0x03,0x80,0x00,0x18,0x0e,0x00,0x00,0x07,0x00,0x38,
-0x00,0x0e,0x00,0x01,0xe0,0x07,0x00,0x00,0x70,0x0e,0x00,0x00,0xf0,0x03,0x80,0x00,
-0x18,0x0f,0x00,0x00,0x07,0x00,0x38,0x00,0x0e,0x00,0x01,0xe0,0x07,0x00,0x00,0xf0,
-0x0f,0x00,0x00,0xf0,0x03,0x80,0x00,0x18,0x07,0x80,0x00,0x0f,0x00,0x38,0x00,0x0f,
-0x00,0x03,0xe0,0x03,0x80,0x01,0xf0,0x07,0x00,0x01,0xf0,0x03,0x80,0x00,0x18,0x03,
-0xc0,0x00,0x1e,0x00,0x1c,0x00,0x07,0x00,0x07,0xe0,0x03,0xc0,0x03,0xf0,0x07,0x80,
-0x03,0xf0,0x03,0x80,0x00,0x18,0x01,0xf0,0x00,0x7c,0x00,0x1c,0x00,0x07,0xc0,0x0e,
-0xe0,0x01,0xe0,0x07,0x70,0x03,0xc0,0x0f,0x70,0x03,0x80,0x00,0x18,0x00,0xfe,0x03,
-0xf8,0x00,0x1f,0x00,0x03,0xf0,0x7c,0xe0,0x00,0xf8,0x3e,0x70,0x01,0xf0,0x7e,0x70,
-0x03,0x80,0x00,0x18,0x00,0x3f,0xff,0xe0,0x00,0x0f,0xf0,0x01,0xff,0xf8,0xe0,0x00,
-0x7f,0xfc,0x70,0x00,0xff,0xf8,0x78,0x03,0x80,0x00,0x18,0x00,0x07,0xff,0x80,0x00,
-0x07,0xf0,0x00,0x7f,0xe0,0xe0,0x00,0x1f,0xf0,0x70,0x00,0x3f,0xe0,0x38,0x03,0x80,
-0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,
-0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x03,0xc0,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x1f,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x7f,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf8,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00};
-Element STUGAN{STUGAN_BYTE_WIDTH, STUGAN_ADVANCE, STUGAN_DATA};
-
-const int TORGET_BYTE_WIDTH = 22;
-const int TORGET_ADVANCE = 174;
-const unsigned char TORGET_DATA[1320] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0xff,0xc0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,
-0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,
-0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x70,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,
-0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x1f,0x00,
-0x03,0xf8,0x00,0x00,0x00,0xfe,0x00,0x00,0xf0,0x00,0x00,0x00,0xe0,0x00,0x00,0x03,
-0xff,0xe0,0x00,0x38,0x7f,0x00,0x1f,0xfe,0x1c,0x00,0x07,0xff,0x80,0x1f,0xff,0xc0,
-0x00,0x00,0xe0,0x00,0x00,0x07,0xf3,0xf8,0x00,0x38,0xff,0x00,0x3f,0xff,0x9c,0x00,
-0x0f,0xcf,0xe0,0x1f,0xff,0xc0,0x00,0x00,0xe0,0x00,0x00,0x1f,0x00,0x7c,0x00,0x39,
-0xe0,0x00,0x7c,0x03,0xdc,0x00,0x1e,0x01,0xf0,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,
-0x00,0x3c,0x00,0x1e,0x00,0x3b,0x80,0x00,0xf0,0x00,0xdc,0x00,0x38,0x00,0x78,0x00,
-0x70,0x00,0x00,0x00,0xe0,0x00,0x00,0x38,0x00,0x0e,0x00,0x3f,0x00,0x00,0xe0,0x00,
-0x7c,0x00,0x70,0x00,0x38,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x00,0x70,0x00,0x07,
-0x00,0x3e,0x00,0x01,0xc0,0x00,0x3c,0x00,0xe0,0x00,0x1c,0x00,0x70,0x00,0x00,0x00,
-0xe0,0x00,0x00,0xf0,0x00,0x07,0x80,0x3c,0x00,0x01,0xc0,0x00,0x3c,0x00,0xe0,0x00,
-0x1c,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x00,0xe0,0x00,0x03,0x80,0x3c,0x00,0x03,
-0x80,0x00,0x1c,0x01,0xc0,0x00,0x0e,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x00,0xe0,
-0x00,0x03,0x80,0x3c,0x00,0x03,0x80,0x00,0x1c,0x01,0xc0,0x00,0x0e,0x00,0x70,0x00,
-0x00,0x00,0xe0,0x00,0x01,0xc0,0x00,0x01,0xc0,0x38,0x00,0x03,0x80,0x00,0x1c,0x01,
-0xc0,0x00,0x0e,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x01,0xc0,0x00,0x01,0xc0,0x38,
-0x00,0x03,0x80,0x00,0x1c,0x03,0x80,0x00,0x0e,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,
-0x01,0xc0,0x00,0x01,0xc0,0x38,0x00,0x07,0x00,0x00,0x1c,0x03,0x80,0x00,0x0e,0x00,
-0x70,0x00,0x00,0x00,0xe0,0x00,0x01,0xc0,0x00,0x01,0xc0,0x38,0x00,0x07,0x00,0x00,
-0x1c,0x03,0x80,0x00,0x0e,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x01,0xc0,0x00,0x01,
-0xc0,0x38,0x00,0x07,0x00,0x00,0x1c,0x03,0xff,0xff,0xfe,0x00,0x70,0x00,0x00,0x00,
-0xe0,0x00,0x01,0xc0,0x00,0x01,0xc0,0x38,0x00,0x07,0x00,0x00,0x1c,0x03,0xff,0xff,
-0xfe,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x01,0xc0,0x00,0x01,0xc0,0x38,0x00,0x07,
-0x00,0x00,0x1c,0x03,0x80,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x01,0xc0,
-0x00,0x01,0xc0,0x38,0x00,0x07,0x00,0x00,0x1c,0x03,0x80,0x00,0x00,0x00,0x70,0x00,
-0x00,0x00,0xe0,0x00,0x01,0xc0,0x00,0x01,0xc0,0x38,0x00,0x07,0x00,0x00,0x1c,0x03,
-0x80,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x01,0xc0,0x00,0x01,0xc0,0x38,
-0x00,0x07,0x00,0x00,0x1c,0x03,0x80,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,
-0x01,0xc0,0x00,0x01,0xc0,0x38,0x00,0x03,0x80,0x00,0x1c,0x03,0x80,0x00,0x00,0x00,
-0x70,0x00,0x00,0x00,0xe0,0x00,0x01,0xc0,0x00,0x01,0xc0,0x38,0x00,0x03,0x80,0x00,
-0x1c,0x03,0x80,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x00,0xe0,0x00,0x03,
-0xc0,0x38,0x00,0x03,0x80,0x00,0x1c,0x01,0xc0,0x00,0x00,0x00,0x70,0x00,0x00,0x00,
-0xe0,0x00,0x00,0xe0,0x00,0x03,0x80,0x38,0x00,0x03,0x80,0x00,0x1c,0x01,0xc0,0x00,
-0x00,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x00,0xf0,0x00,0x07,0x80,0x38,0x00,0x01,
-0xc0,0x00,0x1c,0x00,0xe0,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x00,0x70,
-0x00,0x07,0x00,0x38,0x00,0x01,0xc0,0x00,0x3c,0x00,0xf0,0x00,0x00,0x00,0x70,0x00,
-0x00,0x00,0xe0,0x00,0x00,0x78,0x00,0x0f,0x00,0x38,0x00,0x00,0xe0,0x00,0x7c,0x00,
-0x70,0x00,0x0c,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,0x00,0x3c,0x00,0x1e,0x00,0x38,
-0x00,0x00,0xf0,0x00,0xfc,0x00,0x78,0x00,0x1c,0x00,0x70,0x00,0x00,0x00,0xe0,0x00,
-0x00,0x1e,0x00,0x3c,0x00,0x38,0x00,0x00,0x78,0x01,0xdc,0x00,0x3e,0x00,0x38,0x00,
-0x78,0x00,0x00,0x00,0xe0,0x00,0x00,0x0f,0xc1,0xf8,0x00,0x38,0x00,0x00,0x3e,0x0f,
-0x9c,0x00,0x1f,0x81,0xf0,0x00,0x3c,0x00,0x00,0x00,0xe0,0x00,0x00,0x03,0xff,0xf0,
-0x00,0x38,0x00,0x00,0x1f,0xff,0x1c,0x00,0x07,0xff,0xe0,0x00,0x1f,0xe0,0x00,0x00,
-0xe0,0x00,0x00,0x00,0xff,0x80,0x00,0x38,0x00,0x00,0x07,0xfc,0x1c,0x00,0x01,0xff,
-0x80,0x00,0x0f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xc0,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xe0,0x00,0xf0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xf0,0x01,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x80,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-Element TORGET{TORGET_BYTE_WIDTH, TORGET_ADVANCE, TORGET_DATA};
 
-const int SKOLAN_BYTE_WIDTH = 22;
-const int SKOLAN_ADVANCE = 178;
-const unsigned char SKOLAN_DATA[1320] PROGMEM = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x03,0xfc,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x80,0x00,0xe0,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,
-0xff,0xe0,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x01,0xf8,0x01,0xf8,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xe0,0x00,0x7c,0x00,0xe0,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x03,0xc0,0x00,0x1c,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x00,0x0e,0x00,0xe0,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x0f,
-0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x0f,0x00,0x00,0x07,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x07,0x00,0xe0,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,
-0x00,0x07,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x07,0x80,0xe0,0x00,0x00,0x00,0x03,0xfc,0x00,
-0x00,0xe0,0x00,0x0f,0xf0,0x00,0x00,0x01,0xfc,0x00,0x0f,0x00,0x00,0x00,0x00,0xe0,
-0x00,0x3c,0x00,0x1f,0xff,0x00,0x00,0xe0,0x00,0x7f,0xfe,0x00,0x07,0x07,0xff,0x80,
-0x07,0x00,0x00,0x00,0x00,0xe0,0x00,0x78,0x00,0x3f,0x9f,0xc0,0x00,0xe0,0x00,0xfc,
-0x7f,0x00,0x07,0x1f,0xff,0xc0,0x07,0x00,0x00,0x00,0x00,0xe0,0x00,0xf0,0x00,0x78,
-0x03,0xe0,0x00,0xe0,0x03,0xe0,0x07,0x80,0x07,0x3c,0x03,0xe0,0x07,0x80,0x00,0x00,
-0x00,0xe0,0x01,0xe0,0x00,0xf0,0x00,0xf0,0x00,0xe0,0x03,0x80,0x03,0xc0,0x07,0x70,
-0x01,0xe0,0x03,0xc0,0x00,0x00,0x00,0xe0,0x03,0xc0,0x01,0xe0,0x00,0x78,0x00,0xe0,
-0x07,0x00,0x01,0xc0,0x07,0xe0,0x00,0xf0,0x01,0xf0,0x00,0x00,0x00,0xe0,0x07,0x80,
-0x03,0xc0,0x00,0x38,0x00,0xe0,0x0f,0x00,0x01,0xe0,0x07,0xc0,0x00,0x70,0x00,0xfc,
-0x00,0x00,0x00,0xe0,0x0f,0x00,0x03,0x80,0x00,0x1c,0x00,0xe0,0x0e,0x00,0x00,0xe0,
-0x07,0x80,0x00,0x70,0x00,0x3f,0x80,0x00,0x00,0xe0,0x1e,0x00,0x07,0x00,0x00,0x1c,
-0x00,0xe0,0x0e,0x00,0x00,0xe0,0x07,0x80,0x00,0x70,0x00,0x0f,0xf8,0x00,0x00,0xe0,
-0x3c,0x00,0x07,0x00,0x00,0x0e,0x00,0xe0,0x00,0x00,0x00,0xe0,0x07,0x00,0x00,0x70,
-0x00,0x03,0xff,0x00,0x00,0xe0,0x78,0x00,0x07,0x00,0x00,0x0e,0x00,0xe0,0x00,0x00,
-0x00,0xe0,0x07,0x00,0x00,0x70,0x00,0x00,0x7f,0xc0,0x00,0xe0,0xf0,0x00,0x0e,0x00,
-0x00,0x0e,0x00,0xe0,0x00,0x00,0x00,0xe0,0x07,0x00,0x00,0x30,0x00,0x00,0x07,0xf0,
-0x00,0xe1,0xe0,0x00,0x0e,0x00,0x00,0x0e,0x00,0xe0,0x00,0x00,0x00,0xe0,0x07,0x00,
-0x00,0x30,0x00,0x00,0x01,0xf8,0x00,0xe3,0xc0,0x00,0x0e,0x00,0x00,0x06,0x00,0xe0,
-0x00,0x00,0x00,0xe0,0x07,0x00,0x00,0x30,0x00,0x00,0x00,0x7c,0x00,0xe7,0xc0,0x00,
-0x0e,0x00,0x00,0x07,0x00,0xe0,0x00,0x0f,0xff,0xe0,0x07,0x00,0x00,0x30,0x00,0x00,
-0x00,0x1e,0x00,0xef,0xe0,0x00,0x0e,0x00,0x00,0x07,0x00,0xe0,0x00,0x7f,0xff,0xe0,
-0x07,0x00,0x00,0x30,0x00,0x00,0x00,0x0f,0x00,0xfe,0xf0,0x00,0x0e,0x00,0x00,0x07,
-0x00,0xe0,0x01,0xf8,0x00,0xe0,0x07,0x00,0x00,0x30,0x00,0x00,0x00,0x07,0x00,0xfc,
-0x78,0x00,0x0e,0x00,0x00,0x07,0x00,0xe0,0x03,0xc0,0x00,0xe0,0x07,0x00,0x00,0x30,
-0x00,0x00,0x00,0x07,0x00,0xf8,0x3c,0x00,0x0e,0x00,0x00,0x07,0x00,0xe0,0x07,0x80,
-0x00,0xe0,0x07,0x00,0x00,0x30,0x00,0x00,0x00,0x03,0x80,0xf0,0x1c,0x00,0x0e,0x00,
-0x00,0x0e,0x00,0xe0,0x0f,0x00,0x00,0xe0,0x07,0x00,0x00,0x30,0x1c,0x00,0x00,0x03,
-0x80,0xe0,0x1e,0x00,0x0e,0x00,0x00,0x0e,0x00,0xe0,0x0e,0x00,0x00,0xe0,0x07,0x00,
-0x00,0x30,0x1c,0x00,0x00,0x03,0x80,0xe0,0x0f,0x00,0x07,0x00,0x00,0x0e,0x00,0xe0,
-0x1c,0x00,0x00,0xe0,0x07,0x00,0x00,0x30,0x1c,0x00,0x00,0x03,0x80,0xe0,0x07,0x80,
-0x07,0x00,0x00,0x0e,0x00,0xe0,0x1c,0x00,0x00,0xe0,0x07,0x00,0x00,0x30,0x1e,0x00,
-0x00,0x03,0x80,0xe0,0x03,0xc0,0x07,0x00,0x00,0x1c,0x00,0xe0,0x1c,0x00,0x00,0xe0,
-0x07,0x00,0x00,0x30,0x0e,0x00,0x00,0x07,0x00,0xe0,0x01,0xc0,0x03,0x80,0x00,0x1c,
-0x00,0xe0,0x1c,0x00,0x01,0xe0,0x07,0x00,0x00,0x30,0x0f,0x00,0x00,0x07,0x00,0xe0,
-0x00,0xe0,0x03,0x80,0x00,0x3c,0x00,0xe0,0x1e,0x00,0x01,0xe0,0x07,0x00,0x00,0x30,
-0x07,0x80,0x00,0x0f,0x00,0xe0,0x00,0xf0,0x01,0xc0,0x00,0x78,0x00,0xe0,0x0e,0x00,
-0x03,0xe0,0x07,0x00,0x00,0x30,0x03,0xc0,0x00,0x1e,0x00,0xe0,0x00,0x78,0x01,0xe0,
-0x00,0xf0,0x00,0xe0,0x0f,0x00,0x07,0xe0,0x07,0x00,0x00,0x30,0x01,0xf0,0x00,0x7c,
-0x00,0xe0,0x00,0x3c,0x00,0xf8,0x01,0xe0,0x00,0xe0,0x07,0x80,0x1e,0xe0,0x07,0x00,
-0x00,0x30,0x00,0xfe,0x03,0xf8,0x00,0xe0,0x00,0x1c,0x00,0x7e,0x07,0xc0,0x00,0xe0,
-0x03,0xe0,0xfc,0xe0,0x07,0x00,0x00,0x30,0x00,0x3f,0xff,0xe0,0x00,0xe0,0x00,0x0e,
-0x00,0x1f,0xff,0x80,0x00,0xe0,0x01,0xff,0xf0,0xf0,0x07,0x00,0x00,0x30,0x00,0x07,
-0xff,0x80,0x00,0xe0,0x00,0x0f,0x00,0x07,0xfe,0x00,0x00,0xe0,0x00,0x7f,0xc0,0x70,
-0x07,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-Element SKOLAN{SKOLAN_BYTE_WIDTH, SKOLAN_ADVANCE, SKOLAN_DATA};
\ No newline at end of file
+#endif
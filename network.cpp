@@ -1,21 +1,20 @@
 #include <WiFiNINA.h>
 #include "arduino_secrets.h"
-#include "HttpClient.h"
-#include <ArduinoJson.h>
 #include "bus_description.h"
+#include "departure_cache.h"
+#include "departure_parser.h"
+#include "http_connection.h"
+#include "retry_policy.h"
+#include "stops.h"
+#include "wall_clock.h"
 #include "logging.h"
 
 char ssid[] = SECRET_SSID;
 char pass[] = SECRET_PASS;
 int status = WL_IDLE_STATUS;
 
-// Number of milliseconds to wait without receiving any data before we give up
-const int kNetworkTimeout = 30*1000;
-// Number of milliseconds to wait if no data is available before trying again
-const int kNetworkDelay = 50;
-
 char kHostname[] = "api.sl.se";
-char kPath[] = "/api2/realtimedeparturesV4.json?siteid=%d&timewindow=20&key=%s";
+char kPath[] = "/api2/realtimedeparturesV4.json?siteid=%d&timewindow=60&key=%s";
 
 bool checkWifi() {
   if (WiFi.status() == WL_NO_MODULE) {
@@ -31,323 +30,449 @@ bool checkWifi() {
   return true;
 }
 
-int connectWifi() {
-  DEBUG_PRINTLN("connectWifi");
-
-  // attempt to connect to Wifi network:
-  DEBUG_PRINT("Attempting to connect to WPA SSID: ");
-  DEBUG_PRINTLN(ssid);
-  // Connect to WPA/WPA2 network:
-  status = WiFi.begin(ssid, pass);
-
-  for (int waits = 0; status != WL_CONNECTED; waits++) {
-    if (waits > 300) {
+// Longest we wait to join the network, with and without a saved lease.
+const unsigned long kConnectTimeout = 30*1000;
+const unsigned long kWarmConnectTimeout = 8*1000;
+const unsigned long kConnectPollMs = 50;
+
+// Longest we go on using a lease without asking DHCP again. Routers hand
+// leases out for a day or so, and renewing well inside that keeps the
+// address ours.
+const long kLeaseMaxAgeSecs = 4 * 3600L;
+
+// What DHCP gave us last time. Deep sleep keeps RAM, so the next wake can
+// configure the same addresses and skip DHCP. WiFiNINA can't be told which
+// access point or channel to join, so the BSSID is only kept to notice the
+// board joining a different one.
+struct WifiLease {
+  bool valid;
+  // wallClockNow() when DHCP gave it out.
+  long acquired_at;
+  IPAddress local_ip;
+  IPAddress dns;
+  IPAddress gateway;
+  IPAddress subnet;
+  uint8_t bssid[6];
+};
+
+WifiLease lease;
+
+// millis() when connectWifi() started and when the first response byte
+// arrived, 0 until it has.
+unsigned long wake_millis;
+unsigned long first_byte_millis;
+bool warm_start;
+
+static int waitForConnection(unsigned long timeout) {
+  unsigned long start = millis();
+  for (;;) {
+    status = WiFi.status();
+    if (status == WL_CONNECTED) {
+      return 0;
+    }
+    if (millis() - start > timeout) {
       return -2;
     }
-    delay(100);
+    delay(kConnectPollMs);
   }
-
-  DEBUG_PRINT("Connected to the network");
-  return 0;
 }
 
-bool Earlier(BusDescription* bus1, BusDescription* bus2) {
-  if (bus1->time[0] < bus2->time[0])
-    return true;
-  if (bus1->time[0] == bus2->time[0] && bus1->time[1] < bus2->time[1])
-    return true;
-  // time[2] is a colon.
-  if (bus1->time[0] == bus2->time[0] && bus1->time[1] == bus2->time[1] && bus1->time[3] < bus2->time[3])
-    return true;
-  if (bus1->time[0] == bus2->time[0] && bus1->time[1] == bus2->time[1] && bus1->time[3] == bus2->time[3] && bus1->time[4] < bus2->time[4])
-    return true;
-  return false;
+static bool leaseUsable() {
+  return lease.valid && wallClockValid() && wallClockNow() - lease.acquired_at < kLeaseMaxAgeSecs;
 }
 
-WiFiSSLClient client;
-
-const int kJsonError = 5;
-
-// time is formatted as 01:23:45
-int secondsSinceMidnight(const char* time) {
-  int seconds = 0;
-  seconds += ((time[0] - '0')*10 + (time[1] - '0')) * 3600;
-  seconds += ((time[3] - '0')*10 + (time[4] - '0')) * 60;
-  seconds += ((time[6] - '0')*10 + (time[7] - '0'));
-  return seconds;
+static void rememberLease() {
+  lease.local_ip = WiFi.localIP();
+  lease.dns = WiFi.dnsIP(0);
+  lease.gateway = WiFi.gatewayIP();
+  lease.subnet = WiFi.subnetMask();
+  WiFi.BSSID(lease.bssid);
+  // Without the time we can't tell when it's due for renewal.
+  lease.valid = wallClockValid() && (uint32_t)lease.local_ip != 0;
+  lease.acquired_at = wallClockValid() ? wallClockNow() : 0;
 }
 
-int minutesUntil(const char* queryDateTime, int queryAgeSeconds, const char* datetime) {
-  int now_secs = secondsSinceMidnight(queryDateTime + 11) + queryAgeSeconds;
-  int time_secs = secondsSinceMidnight(datetime + 11);
-
-  return (time_secs - now_secs)/60;
+static bool sameAccessPoint() {
+  uint8_t bssid[6];
+  WiFi.BSSID(bssid);
+  return memcmp(bssid, lease.bssid, sizeof(bssid)) == 0;
 }
 
-BusResults querySingleStop(int stop_id, int minimum_mins) {
-  DEBUG_PRINTLN("\nStarting connection to server...");
-  HttpClient http(client);
-  DEBUG_PRINTLN("Have client");
+int connectWifi() {
+  DEBUG_PRINTLN("connectWifi");
+  wake_millis = millis();
+  first_byte_millis = 0;
+  warm_start = false;
+  // begin() otherwise sits in its own loop, checking only every few
+  // seconds. We poll status ourselves instead.
+  WiFi.setTimeout(0);
 
-  char path_buffer[96];
-  sprintf(path_buffer, kPath, stop_id, SECRET_SL_API_KEY);
+  DEBUG_PRINT("Attempting to connect to WPA SSID: ");
+  DEBUG_PRINTLN(ssid);
+  if (leaseUsable()) {
+    WiFi.config(lease.local_ip, lease.dns, lease.gateway, lease.subnet);
+    WiFi.begin(ssid, pass);
+    if (waitForConnection(kWarmConnectTimeout) == 0 && sameAccessPoint()) {
+      warm_start = true;
+      DEBUG_PRINT("Connected with the saved lease in ");
+      DEBUG_PRINT(millis() - wake_millis);
+      DEBUG_PRINTLN(" ms");
+      return 0;
+    }
+    Serial.println("Saved lease didn't work, asking DHCP");
+    lease.valid = false;
+    // Resets the module, which drops the static addresses.
+    WiFi.end();
+  }
 
-  int err = http.get(kHostname, 443, path_buffer);
+  WiFi.begin(ssid, pass);
+  int err = waitForConnection(kConnectTimeout);
   if (err != 0) {
-    Serial.print("connect failed: ");
-    Serial.println(err);
-    return BusResults{result:err};
+    Serial.print("Failed to connect, status ");
+    Serial.println(status);
+    return err;
   }
-  DEBUG_PRINTLN("startedRequest ok");
+  rememberLease();
+  DEBUG_PRINT("Connected to the network in ");
+  DEBUG_PRINT(millis() - wake_millis);
+  DEBUG_PRINTLN(" ms");
+  return 0;
+}
 
-  err = http.responseStatusCode();
-  if (err != 200) {
-    Serial.print("Get returned status code: ");
-    Serial.println(err);
-    return BusResults{result:err};
+// Sockets the stop queries are spread over, stop i going to socket
+// i % kFetchSockets. The NINA firmware has several, but connect() blocks
+// for the whole TLS handshake, so each extra socket adds a handshake's
+// worth of time up front. With the queries pipelined on one connection the
+// responses already come back to back, so one is usually quickest.
+const int kFetchSockets = 1;
+
+// Number of milliseconds a request may go without receiving any data before
+// we give up on it
+const unsigned long kRequestTimeout = 30*1000;
+// Longest we wait if no socket has data before looking again
+const unsigned long kMaxNetworkDelay = 50;
+
+// A stop's query and the parser its response feeds.
+struct StopFetch {
+  char path[96];
+  int failures;
+  bool done;
+  // Failed in a way retryAllowed() won't ask again about this cycle.
+  bool gave_up;
+  // Not to be sent again before this millis().
+  unsigned long retry_at;
+  // Sent and waiting in a socket's queue.
+  bool queued;
+  // The parser has what it needs, so the rest of the body is dropped.
+  bool skipping;
+  unsigned long sent_at;
+  BusDescription* descs;
+  DepartureParser parser;
+  BusResults result;
+};
+
+// A socket and the stops whose responses are due on it, oldest first.
+struct FetchSocket {
+  HttpConnection connection;
+  int queue[kMaxPipelined];
+  int queue_len;
+  // Stops to be sent on it that aren't yet, retries included.
+  int waiting;
+  unsigned long last_data;
+};
+
+WiFiSSLClient clients[kFetchSockets];
+
+static void failStop(StopFetch* fetch, int err) {
+  free(fetch->descs);
+  fetch->descs = NULL;
+  fetch->queued = false;
+  fetch->failures++;
+  fetch->result = BusResults{result:err};
+
+  unsigned long delay_ms;
+  if (retryAllowed(err, fetch->failures, &delay_ms)) {
+    fetch->retry_at = millis() + delay_ms;
+  } else {
+    fetch->gave_up = true;
   }
+}
 
-  err = http.skipResponseHeaders();
-  if (err != 0) {
-    Serial.print("Failed skipping headers: ");
-    Serial.println(err);
-    return BusResults{result:err};
+// Forgets everything queued on socket and closes it. The head stop is
+// failed with err unless err is 0; the rest are sent again later.
+static void dropQueue(FetchSocket* socket, StopFetch* fetches, int err) {
+  for (int k = 0; k < socket->queue_len; k++) {
+    StopFetch* fetch = &fetches[socket->queue[k]];
+    if (k == 0 && err != 0) {
+      failStop(fetch, err);
+      continue;
+    }
+    free(fetch->descs);
+    fetch->descs = NULL;
+    fetch->queued = false;
   }
+  socket->queue_len = 0;
+  httpStop(&socket->connection);
+}
 
-  int bodyLen = http.contentLength();
-  DEBUG_PRINT("Content length is: ");
-  DEBUG_PRINTLN(bodyLen);
-
-  unsigned long timeoutStart = millis();
-
-  char buffer[10000];
-  char* curr_buffer_pos = buffer;
-  if (bodyLen > 10000) {
-    return BusResults{result:-4};
-  } 
-
-  char c;
-  // Whilst we haven't timed out & haven't reached the end of the body
-  while ( (http.connected() || http.available()) &&
-          ((millis() - timeoutStart) < kNetworkTimeout) && bodyLen) {
-      if (http.available()) {
-          c = http.read();
-          // Print out this character
-          DEBUG_PRINT(c);
-          *curr_buffer_pos = c;
-          curr_buffer_pos++;
-          
-          bodyLen--;
-          // We read something, reset the timeout counter
-          timeoutStart = millis();
-      } else {
-          // We haven't got any data, so let's pause to allow some to
-          // arrive
-          delay(kNetworkDelay);
-      }
+static void sendStop(FetchSocket* socket, StopFetch* fetches, int stop) {
+  StopFetch* fetch = &fetches[stop];
+  if (socket->queue_len == kMaxPipelined) {
+    return;
   }
-  http.stop();
-  DEBUG_PRINTLN();
-
-  if (bodyLen) {
-    // Didn't read the full body.
-    return BusResults{result: -7};
+  fetch->descs = (BusDescription*)(malloc(sizeof(BusDescription) * kMaxStopDepartures));
+  if (fetch->descs == NULL) {
+    failStop(fetch, -6);
+    return;
   }
-
-  *curr_buffer_pos = '\0';
-
-  StaticJsonDocument<5000> json_doc;
-  
-  DeserializationError json_error = deserializeJson(json_doc, buffer);
-
-  // Test if parsing succeeds.
-  if (json_error) {
-    Serial.print(F("deserializeJson() failed: "));
-    Serial.println(json_error.f_str());
-    return BusResults{result: kJsonError};
+  int err = httpSendGet(&socket->connection, fetch->path);
+  if (err != 0) {
+    failStop(fetch, err);
+    // The connection was closed, taking anything queued with it.
+    dropQueue(socket, fetches, 0);
+    return;
   }
-
-  DEBUG_PRINT("StatusCode: ");
-  int status_code = json_doc["StatusCode"];
-  DEBUG_PRINTLN(status_code);
-
-  if (status_code != 0) {
-    return BusResults{result:status_code};
+  departureParserBegin(&fetch->parser, kStopTable[stop].id, kStopTable[stop].minimum_mins, fetch->descs);
+  fetch->queued = true;
+  fetch->skipping = false;
+  fetch->sent_at = millis();
+  if (socket->queue_len == 0) {
+    socket->last_data = millis();
   }
+  socket->queue[socket->queue_len++] = stop;
+}
 
-  int res_count = json_doc["ResponseData"]["Buses"].size();
+// Finishes the stop at the head of socket's queue.
+static void completeHead(FetchSocket* socket, StopFetch* fetches, int status_code) {
+  int stop = socket->queue[0];
+  StopFetch* fetch = &fetches[stop];
+  int result = status_code == 200 ? departureParserEnd(&fetch->parser) : status_code;
+
+  DEBUG_PRINT("Stop ");
+  DEBUG_PRINT(kStopTable[stop].id);
+  DEBUG_PRINT(" result ");
+  DEBUG_PRINT(result);
+  DEBUG_PRINT(" after ");
+  DEBUG_PRINT(millis() - fetch->sent_at);
+  DEBUG_PRINTLN(" ms");
+
+  if (result == 0) {
+    fetch->done = true;
+    fetch->queued = false;
+    fetch->result = BusResults{result: 0, descs: fetch->descs, len: fetch->parser.count};
+  } else {
+    failStop(fetch, result);
+  }
 
-  BusDescription* descs = (BusDescription*)(malloc(sizeof(BusDescription) * res_count));
-  if (descs <= 0) {
-    return BusResults{result: -6};
+  socket->queue_len--;
+  for (int k = 0; k < socket->queue_len; k++) {
+    socket->queue[k] = socket->queue[k + 1];
   }
+  httpNextResponse(&socket->connection);
+  socket->last_data = millis();
+}
 
-  int matching_busses = 0;
-  for (int i = 0; i < res_count; i++) {
-    JsonObject bus = json_doc["ResponseData"]["Buses"][i];
-
-    if(bus["JourneyDirection"] != 2)
-      continue; // Probably means it's not going into town.
-
-    int mins = minutesUntil(json_doc["ResponseData"]["LatestUpdate"], json_doc["ResponseData"]["DataAge"], bus["ExpectedDateTime"]);
-    /*
-    const char* display_time = bus["DisplayTime"];
-    int mins = 0;
-    if (display_time[0] == 'N') {
-      mins = 0;
-    } else if (display_time[1] == ' ') {
-      mins = display_time[0] - '0';
+// Moves along whatever has arrived on socket. Returns whether anything did.
+static bool serviceSocket(FetchSocket* socket, StopFetch* fetches) {
+  if (socket->queue_len == 0) {
+    return false;
+  }
+  HttpConnection* connection = &socket->connection;
+  HttpResponse* response = &connection->response;
+  StopFetch* head = &fetches[socket->queue[0]];
+
+  unsigned long received = connection->bytes_received;
+  uint8_t chunk[64];
+  int n = httpPoll(connection, chunk, sizeof(chunk));
+  if (n < 0) {
+    if (n == kConnectionLost) {
+      DEBUG_PRINTLN("Server had closed the connection");
     } else {
-      mins = (display_time[0] - '0')*10 + display_time[1] - '0';
+      Serial.println("Response truncated");
     }
-    */
-    if (mins < minimum_mins) {
-      continue;
+    dropQueue(socket, fetches, n == kConnectionLost ? 0 : n);
+    return true;
+  }
+  // httpPoll() may decode body bytes already in its ring without reading
+  // anything new, so n counts as progress as much as fresh bytes do.
+  if (n == 0 && connection->bytes_received == received && !response->finished) {
+    if (millis() - socket->last_data > kRequestTimeout) {
+      Serial.print("Timed out waiting for stop ");
+      Serial.println(kStopTable[socket->queue[0]].id);
+      dropQueue(socket, fetches, kBodyTruncated);
+      return true;
     }
+    return false;
+  }
+  socket->last_data = millis();
+  if (first_byte_millis == 0) {
+    first_byte_millis = millis();
+  }
 
-    const char* line_number = bus["LineNumber"];
-    memcpy(&descs[matching_busses].number, line_number, 3);
-
-    const char* expected_time = bus["ExpectedDateTime"];
-    memcpy(&descs[matching_busses].time, expected_time + 11, 5);
-
-    descs[matching_busses].journey_number = bus["JourneyNumber"];
-    descs[matching_busses].stop_id = stop_id;
-/*
-    if(display_time[0] == 'N') {
-      descs[matching_busses].mins[0] = '0';
-      descs[matching_busses].mins[1] = '0';
-    } else if (display_time[1] == ' ') {
-      descs[matching_busses].mins[0] = '0';
-      descs[matching_busses].mins[1] = display_time[0];
-    } else {
-      memcpy(&descs[matching_busses].mins, display_time, 2);
+  if (response->headers_done && response->status_code != 200 && !head->skipping) {
+    Serial.print("Get returned status code: ");
+    Serial.println(response->status_code);
+    head->skipping = true;
+  }
+  for (int i = 0; i < n && !head->skipping; i++) {
+    if (!departureParserFeed(&head->parser, chunk[i])) {
+      head->skipping = true;
+      if (socket->queue_len == 1 && socket->waiting == 0 && departureParserEnd(&head->parser) == 0) {
+        // Nothing else is coming or will be asked for, so hang up rather
+        // than download the rest. Otherwise the rest is read and dropped to
+        // keep the connection for the requests still to go.
+        httpStop(connection);
+        completeHead(socket, fetches, 200);
+        return true;
+      }
     }
-    */
-    descs[matching_busses].mins[0] = ((mins / 10) % 10) + '0';
-    descs[matching_busses].mins[1] = (mins % 10) + '0';
+  }
+  if (response->finished) {
+    completeHead(socket, fetches, response->status_code);
+  }
+  return true;
+}
 
-    matching_busses++;
+// Queries every stop, servicing whichever socket has data rather than
+// waiting on each response in turn. Each socket's requests are sent back to
+// back over one keep-alive connection and each response feeds its own stop's
+// parser. Stops that fail are asked again as retryAllowed() permits, after a
+// backoff. If the server closes a connection between responses, the requests
+// it hadn't answered are sent again on a new one without counting as a
+// failure. *now is set to the time the API gave, if any stop was fetched.
+void queryStops(BusResults* results, long* now) {
+  FetchSocket sockets[kFetchSockets];
+  for (int s = 0; s < kFetchSockets; s++) {
+    httpBegin(&sockets[s].connection, &clients[s], kHostname, 443);
+    sockets[s].queue_len = 0;
   }
 
-  return BusResults{
-    result: 0,
-    descs: descs,
-    len: matching_busses,
-  };
-}
+  StopFetch fetches[kStops];
+  for (int i = 0; i < kStops; i++) {
+    sprintf(fetches[i].path, kPath, kStopTable[i].id, SECRET_SL_API_KEY);
+    fetches[i].failures = 0;
+    fetches[i].done = false;
+    fetches[i].gave_up = false;
+    fetches[i].retry_at = 0;
+    fetches[i].queued = false;
+    fetches[i].descs = NULL;
+    fetches[i].result = BusResults{result: kConnectionLost};
+  }
 
-const int kRetries = 3;
+  unsigned long start = millis();
+  unsigned long wait_ms = 1;
+  int handshakes = 0;
+  for (;;) {
+    bool active = false;
+    for (int s = 0; s < kFetchSockets; s++) {
+      sockets[s].waiting = 0;
+    }
+    for (int i = 0; i < kStops; i++) {
+      StopFetch* fetch = &fetches[i];
+      if (fetch->done || fetch->gave_up || fetch->queued) {
+        active |= fetch->queued;
+        continue;
+      }
+      // Bounds the reconnects if the server hangs up on every request. Any
+      // send may reconnect, so this is counted afresh for each.
+      handshakes = 0;
+      for (int s = 0; s < kFetchSockets; s++) {
+        handshakes += sockets[s].connection.handshakes;
+      }
+      if (handshakes > kRetryBudget + kStops) {
+        fetch->gave_up = true;
+        continue;
+      }
+      active = true;
+      if ((long)(millis() - fetch->retry_at) >= 0) {
+        sendStop(&sockets[i % kFetchSockets], fetches, i);
+      }
+      sockets[i % kFetchSockets].waiting += !fetch->queued && !fetch->gave_up;
+    }
+    if (!active) {
+      break;
+    }
 
-BusResults querySingleStopWithRetries(int stop_id, int minimum_mins) {
-  BusResults last_error;
-  for (int attempt = 0; attempt < kRetries; attempt++) {
-    BusResults results = querySingleStop(stop_id, minimum_mins);
-    if (results.result == 0) {
-      return results;
+    bool progress = false;
+    for (int s = 0; s < kFetchSockets; s++) {
+      progress |= serviceSocket(&sockets[s], fetches);
+    }
+    if (progress) {
+      wait_ms = 1;
+    } else {
+      // Nothing yet. Back off, but not so far that we sit on data that has
+      // already arrived.
+      delay(wait_ms);
+      wait_ms = wait_ms * 2 < kMaxNetworkDelay ? wait_ms * 2 : kMaxNetworkDelay;
     }
-    last_error = results;
   }
-  return last_error;
-}
 
-BusResults queryWebService() {
-  // 4010 - torget
-  BusResults results1 = querySingleStopWithRetries(4010, 3);
-  if (results1.result != 0) {
-    Serial.println("Stop1 failed");
-    return results1;
-  }
-  Serial.print("Stop1 gave result count: ");
-  Serial.println(results1.len);
-
-  // 4028 - Stugan
-  BusResults results2 = querySingleStopWithRetries(4028, 5);
-  if (results2.result != 0) {
-    Serial.println("Stop2 failed");
-    free(results1.descs);
-    return results2;
+  unsigned long bytes = 0;
+  handshakes = 0;
+  for (int s = 0; s < kFetchSockets; s++) {
+    bytes += sockets[s].connection.bytes_received;
+    handshakes += sockets[s].connection.handshakes;
+    httpStop(&sockets[s].connection);
   }
-  Serial.print("Stop2 gave result count: ");
-  Serial.println(results2.len);
-
-  // 4027 - Skolan
-  BusResults results3 = querySingleStopWithRetries(4027, 15);
-  if (results3.result != 0) {
-    Serial.println("Stop3 failed");
-    free(results1.descs);
-    free(results2.descs);
-    return results3;
+  for (int i = 0; i < kStops; i++) {
+    results[i] = fetches[i].result;
+    if (fetches[i].done && fetches[i].parser.now > *now) {
+      *now = fetches[i].parser.now;
+    }
   }
-  Serial.print("Stop3 gave result count: ");
-  Serial.println(results3.len);
-
-  // First dedupe based on journey_number, to handle when a single bus stops at multiple of our stops.
-  // Take the earliest stop, which is usually right for us.
-  int max_result = results1.len + results2.len + results3.len;
-  BusDescription* combined_descs = (BusDescription*)(malloc(sizeof(BusDescription) * max_result));
-  int unique_result_count = results1.len;
-  for(int i = 0; i < results1.len; i++) {
-    combined_descs[i] = results1.descs[i];
+
+  Serial.print("Fetched ");
+  Serial.print(bytes);
+  Serial.print(" bytes in ");
+  Serial.print(millis() - start);
+  Serial.print(" ms, HTTPS handshakes this cycle: ");
+  Serial.println(handshakes);
+  if (first_byte_millis != 0) {
+    Serial.print("First byte ");
+    Serial.print(first_byte_millis - wake_millis);
+    Serial.print(" ms after waking, Wi-Fi ");
+    Serial.println(warm_start ? "warm" : "cold");
   }
-  free(results1.descs);
-
-  for(int i = 0; i < results2.len; i++) {
-    bool already_included = false;
-    for (int j = 0; j < unique_result_count; j++) {
-      if (results2.descs[i].journey_number == combined_descs[j].journey_number) {
-        if (Earlier(&results2.descs[i], &combined_descs[j])) {
-          memcpy(combined_descs[j].time, results2.descs[i].time, 5);
-          combined_descs[j].stop_id = results2.descs[i].stop_id;
-        }
-        already_included = true;
-        break;
+}
+
+int queryWebService() {
+  BusResults results[kStops];
+  long now = 0;
+  queryStops(results, &now);
+  int result = 0;
+  bool reached_server = false;
+  for (int i = 0; i < kStops; i++) {
+    // -1 is a connect() that failed, which a stale lease would cause.
+    reached_server |= results[i].result != -1;
+    retryStopDone(results[i].result);
+    if (results[i].result != 0) {
+      Serial.print("Stop");
+      Serial.print(i + 1);
+      Serial.println(" failed");
+      if (result == 0) {
+        result = results[i].result;
       }
+      continue;
     }
-    if (!already_included) {
-      combined_descs[unique_result_count++] = results2.descs[i];
-    }
+    Serial.print("Stop");
+    Serial.print(i + 1);
+    Serial.print(" gave result count: ");
+    Serial.println(results[i].len);
   }
-  free(results2.descs);
-
-  for(int i = 0; i < results3.len; i++) {
-    bool already_included = false;
-    for (int j = 0; j < unique_result_count; j++) {
-      if (results3.descs[i].journey_number == combined_descs[j].journey_number) {
-        if (Earlier(&results3.descs[i], &combined_descs[j])) {
-          memcpy(combined_descs[j].time, results3.descs[i].time, 5);
-          combined_descs[j].stop_id = results3.descs[i].stop_id;
-        }
-        already_included = true;
-        break;
-      }
-    }
-    if (!already_included) {
-      combined_descs[unique_result_count++] = results3.descs[i];
-    }
+
+  if (!reached_server) {
+    // The addresses may no longer be ours, so let DHCP decide next time.
+    lease.valid = false;
   }
-  free(results3.descs);
-
-  DEBUG_PRINT("Combined to give a result count of : ");
-  DEBUG_PRINTLN(unique_result_count);
-
-  // Bubble sort 'cos I'm lazy (and the list is always small anyway).
-  while(true) {
-    bool done = true;
-    for (int j = 0; j < unique_result_count-1; j++) {
-      if (Earlier(&combined_descs[j+1], &combined_descs[j])) {
-        BusDescription temp = combined_descs[j];
-        combined_descs[j] = combined_descs[j+1];
-        combined_descs[j+1] = temp;
-        done = false;
-      }
-    }
-    if (done) {
-      break;
+
+  // Whatever did work is kept, so one flaky stop doesn't cost the others.
+  departureCacheStore(results, now);
+  for (int i = 0; i < kStops; i++) {
+    if (results[i].result == 0) {
+      free(results[i].descs);
     }
   }
-
-  return BusResults{result: 0, descs: combined_descs, len:unique_result_count};
+  return result;
 }
 
 int endWifi() {
@@ -3,8 +3,13 @@
 
 #include "bus_description.h"
 bool checkWifi();
+// Joins the network, reusing the addresses DHCP gave last time if they're
+// recent enough. Returns 0, or -2 if it couldn't connect.
 int connectWifi();
-BusResults queryWebService();
+// Fetches every stop into the departure cache. Returns 0, or the error from
+// the first stop that failed; the stops that worked are cached all the same.
+// Each stop's outcome goes to retryStopDone().
+int queryWebService();
 int endWifi();
 
 #endif
\ No newline at end of file
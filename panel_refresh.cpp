@@ -0,0 +1,72 @@
+#include <Arduino.h>
+
+#include "panel_refresh.h"
+#include "render.h"
+#include "logging.h"
+
+// Fingerprint of the frame on the panel, 0 until the first refresh. Globals
+// survive deep sleep, so this carries over from one wake to the next.
+static uint32_t displayed_fingerprint = 0;
+// Wakes that rendered a frame, and those of them that left the panel asleep
+// because the frame was unchanged.
+static unsigned long frames_rendered = 0;
+static unsigned long refreshes_skipped = 0;
+// Starts at the limit so the first refresh after power-on is a full one.
+static int partial_refreshes = kFullRefreshEvery;
+
+void forceFullRefresh() {
+  partial_refreshes = kFullRefreshEvery;
+}
+
+int showRender(Epd* epd) {
+  frames_rendered++;
+  uint32_t fingerprint = RenderFingerprint();
+  if (fingerprint == displayed_fingerprint) {
+    refreshes_skipped++;
+    Serial.print("Frame unchanged, panel left asleep. Skipped ");
+    Serial.print(refreshes_skipped);
+    Serial.print(" of ");
+    Serial.print(frames_rendered);
+    Serial.println(" refreshes");
+    return kRefreshSkipped;
+  }
+
+  int x, y, w, h;
+  int waveform = EPD_WAVEFORM_FULL;
+  if (partial_refreshes < kFullRefreshEvery && RenderDirtyWindow(&x, &y, &w, &h)) {
+    waveform = w * h <= EPD_WIDTH * EPD_HEIGHT / 2 ? EPD_WAVEFORM_PARTIAL : EPD_WAVEFORM_FAST;
+  }
+
+  if (epd->Init(waveform) != 0) {
+      Serial.print("e-Paper init failed\r\n ");
+      return kRefreshFailed;
+  }
+
+  // Init() falls back to the full waveform when it can't use the one asked
+  // for, and only the partial one can refresh a window.
+  int refresh;
+  if (epd->Waveform() == EPD_WAVEFORM_PARTIAL) {
+    DEBUG_PRINTLN("Partial refresh");
+    epd->DisplayWindow(&RenderRows, &RowSpan, &RenderDisplayedRows, &DisplayedRowSpan, x, y, w, h);
+    refresh = kRefreshWindow;
+  } else if (epd->Waveform() == EPD_WAVEFORM_FAST) {
+    DEBUG_PRINTLN("Fast frame refresh");
+    epd->DisplayRows(&RenderRows, &RowSpan, &RenderDisplayedRows, &DisplayedRowSpan);
+    refresh = kRefreshFast;
+  } else {
+    DEBUG_PRINTLN("Full frame refresh");
+    epd->DisplayRows(&RenderRows, &RowSpan);
+    refresh = kRefreshFull;
+  }
+  if (refresh == kRefreshFull) {
+    partial_refreshes = 0;
+  } else {
+    partial_refreshes++;
+  }
+  MarkRenderDisplayed();
+
+  DEBUG_PRINTLN("Sleeping display");
+  epd->Sleep();
+  displayed_fingerprint = fingerprint;
+  return refresh;
+}
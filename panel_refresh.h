@@ -0,0 +1,30 @@
+#ifndef panel_refresh_h
+#define panel_refresh_h
+
+#include "epd7in5_V2.h"
+
+// Number of partial or fast refreshes allowed between full ones. They leave
+// some ghosting behind, which a full refresh clears.
+const int kFullRefreshEvery = 10;
+
+// What showRender() did.
+enum {
+  kRefreshSkipped,
+  kRefreshFull,
+  kRefreshFast,
+  kRefreshWindow,
+  kRefreshFailed,
+};
+
+// Wakes the panel and shows the rendered frame, unless it is the frame the
+// panel already shows. Routine updates redraw only the lines that changed, as
+// a partial window, or the whole frame with the fast waveform when most of it
+// changed. Every kFullRefreshEvery updates, or when the panel is too cold for
+// the fast waveforms, the full waveform clears the ghosting they leave.
+// tools/epdsim drives the panel through this too.
+int showRender(Epd* epd);
+
+// Makes the next refresh a full one.
+void forceFullRefresh();
+
+#endif
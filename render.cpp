@@ -0,0 +1,552 @@
+#include <Arduino.h>
+
+#include "render.h"
+#include "epd7in5_V2.h"
+#include "imagedata.h"
+#include "battery_monitor.h"
+#include "stops.h"
+#include "logging.h"
+
+// The display list is a fixed pool filled in layout order, so a refresh never
+// touches the heap. Each record is a position plus a glyph id.
+const int kMaxRenderElements = 128;
+
+struct RenderElement {
+  int16_t x;
+  int16_t y;
+
+  Glyph glyph;
+};
+
+static RenderElement render_elements[kMaxRenderElements];
+static int render_element_count = 0;
+// Elements dropped since the last ClearRenderElements() because the pool was full.
+static int render_overflow = 0;
+
+// Copy of the display list last sent to the panel. A partial refresh streams
+// it as the window's old data, which the controller loses in deep sleep.
+static RenderElement displayed_elements[kMaxRenderElements];
+static int displayed_element_count = 0;
+
+// Scanline index over render_elements, rebuilt by IndexRenderElements() once
+// layout is done. by_top holds every element ordered by its top row, and
+// active holds the elements crossing scan_y ordered by their left edge, so a
+// row only costs as much as the elements that overlap it.
+static RenderElement* by_top[kMaxRenderElements];
+static int by_top_count = 0;
+static int next_to_enter = 0;
+// Streams a glyph's PackBits data (see imagedata.h) a row at a time, so an
+// element is decompressed as the scanline moves down it and never held whole.
+struct GlyphDecoder {
+  const unsigned char* src;
+  uint8_t run_left;
+  bool literal;
+  unsigned char value;
+  // Row the next decoded byte belongs to.
+  int16_t row;
+};
+
+struct ActiveElement {
+  RenderElement* re;
+  GlyphDecoder dec;
+};
+
+static ActiveElement active[kMaxRenderElements];
+static int active_count = 0;
+static int scan_y = -1;
+// Whether the index is over displayed_elements rather than render_elements.
+static bool indexed_displayed = false;
+
+// Rows that hold any element, as runs of rows sharing one conservative byte
+// column range [first_byte, end_byte). Everything outside them is blank.
+struct OccupiedRun {
+  int16_t top;
+  int16_t bottom;
+  uint8_t first_byte;
+  uint8_t end_byte;
+};
+
+const int kMaxOccupiedRuns = 16;
+static OccupiedRun occupied_runs[kMaxOccupiedRuns];
+static int occupied_run_count = 0;
+
+// Every line RenderBusDescs() lays out goes in a slot: departures 0 to 6, then
+// the status and battery lines. A slot keeps a fingerprint of its elements and
+// the box they cover, for this frame and for the frame last displayed, so a
+// partial refresh only has to redraw the slots that differ.
+const int kStatusSlot = 7;
+const int kBatterySlot = 8;
+const int kLineSlots = 9;
+
+struct LineState {
+  uint32_t hash;
+  int16_t top;
+  int16_t bottom;
+  uint8_t first_byte;
+  uint8_t end_byte;
+};
+
+static LineState lines[kLineSlots];
+static LineState displayed_lines[kLineSlots];
+
+// Row rendered for printElements(), which hands it out a byte at a time.
+static unsigned char row_cache[EPD_WIDTH/8];
+static int row_cache_y = -1;
+
+// Glyph metrics, read from the flat tables in imagedata.h.
+static int GlyphByteWidth(Glyph glyph) {
+  return pgm_read_byte_near(GLYPH_BYTE_WIDTH + glyph);
+}
+
+static int GlyphAdvance(Glyph glyph) {
+  return pgm_read_byte_near(GLYPH_ADVANCE + glyph);
+}
+
+static const unsigned char* GlyphData(Glyph glyph) {
+  return GLYPH_ATLAS + pgm_read_word_near(GLYPH_OFFSET + glyph);
+}
+
+static int ElementTop(RenderElement* re) {
+  return re->y - DIGIT_HEIGHT + pgm_read_byte_near(GLYPH_TOP + re->glyph);
+}
+
+static int ElementBottom(RenderElement* re) {
+  return ElementTop(re) + pgm_read_byte_near(GLYPH_HEIGHT + re->glyph);
+}
+
+static void AddOccupied(int top, int bottom, int first_byte, int end_byte) {
+  if (first_byte < 0) {
+    first_byte = 0;
+  }
+  if (end_byte > EPD_WIDTH/8) {
+    end_byte = EPD_WIDTH/8;
+  }
+  if (first_byte >= end_byte) {
+    return;
+  }
+  OccupiedRun* run = occupied_run_count ? &occupied_runs[occupied_run_count - 1] : nullptr;
+  // Elements arrive sorted by top, so only the last run can overlap. Once the
+  // table is full, keep widening the last run rather than lose coverage.
+  if (!run || (top >= run->bottom && occupied_run_count < kMaxOccupiedRuns)) {
+    run = &occupied_runs[occupied_run_count++];
+    run->top = top;
+    run->bottom = bottom;
+    run->first_byte = first_byte;
+    run->end_byte = end_byte;
+    return;
+  }
+  if (bottom > run->bottom) {
+    run->bottom = bottom;
+  }
+  if (first_byte < run->first_byte) {
+    run->first_byte = first_byte;
+  }
+  if (end_byte > run->end_byte) {
+    run->end_byte = end_byte;
+  }
+}
+
+static void IndexRenderElements(RenderElement* elements, int count) {
+  // Insertion sort: lines are laid out top to bottom, so this is close to linear.
+  by_top_count = 0;
+  for (int n = 0; n < count; n++) {
+    RenderElement* re = &elements[n];
+    int i = by_top_count++;
+    while (i > 0 && ElementTop(by_top[i-1]) > ElementTop(re)) {
+      by_top[i] = by_top[i-1];
+      i--;
+    }
+    by_top[i] = re;
+  }
+
+  occupied_run_count = 0;
+  for (int i = 0; i < by_top_count; i++) {
+    RenderElement* re = by_top[i];
+    AddOccupied(ElementTop(re), ElementBottom(re), re->x >> 3, ((re->x + GlyphByteWidth(re->glyph)*8 - 1) >> 3) + 1);
+  }
+
+  next_to_enter = 0;
+  active_count = 0;
+  scan_y = -1;
+  row_cache_y = -1;
+}
+
+// Points the index at the current or the displayed frame, rebuilding it only
+// when that changes.
+static void IndexFrame(bool displayed) {
+  if (displayed == indexed_displayed) {
+    return;
+  }
+  if (displayed) {
+    IndexRenderElements(displayed_elements, displayed_element_count);
+  } else {
+    IndexRenderElements(render_elements, render_element_count);
+  }
+  indexed_displayed = displayed;
+}
+
+static void StartDecoder(GlyphDecoder* dec, Glyph glyph) {
+  dec->src = GlyphData(glyph);
+  dec->run_left = 0;
+  dec->row = 0;
+}
+
+static unsigned char DecodeByte(GlyphDecoder* dec) {
+  if (dec->run_left == 0) {
+    unsigned char control = pgm_read_byte_near(dec->src++);
+    dec->literal = control < 128;
+    if (dec->literal) {
+      dec->run_left = control + 1;
+    } else {
+      dec->run_left = 257 - control;
+      dec->value = pgm_read_byte_near(dec->src++);
+    }
+  }
+  dec->run_left--;
+  return dec->literal ? pgm_read_byte_near(dec->src++) : dec->value;
+}
+
+// Positions dec at the start of row, restarting if it has already passed it.
+static void SeekRow(GlyphDecoder* dec, Glyph glyph, int row) {
+  if (dec->row > row) {
+    StartDecoder(dec, glyph);
+  }
+  int byte_width = GlyphByteWidth(glyph);
+  for (; dec->row < row; dec->row++) {
+    for (int i = 0; i < byte_width; i++) {
+      DecodeByte(dec);
+    }
+  }
+}
+
+static void AdvanceScanline(int y) {
+  if (y < scan_y) {
+    // Starting a new frame.
+    next_to_enter = 0;
+    active_count = 0;
+  }
+
+  // Drop elements whose bottom row is above this scanline.
+  int kept = 0;
+  for (int i = 0; i < active_count; i++) {
+    if (ElementBottom(active[i].re) > y) {
+      active[kept++] = active[i];
+    }
+  }
+  active_count = kept;
+
+  // Enter elements whose top row has been reached, keeping active sorted by x.
+  while (next_to_enter < by_top_count && ElementTop(by_top[next_to_enter]) <= y) {
+    RenderElement* re = by_top[next_to_enter++];
+    if (ElementBottom(re) <= y) {
+      continue;
+    }
+    int i = active_count++;
+    while (i > 0 && active[i-1].re->x > re->x) {
+      active[i] = active[i-1];
+      i--;
+    }
+    active[i].re = re;
+    StartDecoder(&active[i].dec, re->glyph);
+  }
+
+  scan_y = y;
+}
+
+// ORs one row of an element's glyph into a scanline. Three glyph bytes at a
+// time are placed at the top of a 32-bit word so shifting them to the element's
+// bit offset loses nothing, then the word is OR'd back a byte at a time (the
+// M0+ faults on unaligned word stores).
+static void BlitRow(ActiveElement* ae, int row, unsigned char* dst) {
+  const RenderElement* re = ae->re;
+  int byte_width = GlyphByteWidth(re->glyph);
+  const int row_bytes = EPD_WIDTH/8;
+  int first_byte = re->x >> 3;
+
+  SeekRow(&ae->dec, re->glyph, row);
+  int shift = re->x & 7;
+  for (int i = 0; i < byte_width; i += 3) {
+    uint32_t word = (uint32_t)DecodeByte(&ae->dec) << 24;
+    if (i + 1 < byte_width) {
+      word |= (uint32_t)DecodeByte(&ae->dec) << 16;
+    }
+    if (i + 2 < byte_width) {
+      word |= (uint32_t)DecodeByte(&ae->dec) << 8;
+    }
+    word >>= shift;
+    for (int k = 0; k < 4; k++) {
+      int b = first_byte + i + k;
+      if (b >= 0 && b < row_bytes) {
+        dst[b] |= word >> (24 - 8*k);
+      }
+    }
+  }
+  ae->dec.row++;
+}
+
+static void FillRows(unsigned char* band, int y, int rows) {
+  const int row_bytes = EPD_WIDTH/8;
+  memset(band, 0, rows * row_bytes);
+  for (int r = 0; r < rows; r++) {
+    AdvanceScanline(y + r);
+    for (int i = 0; i < active_count; i++) {
+      BlitRow(&active[i], y + r - ElementTop(active[i].re), band + r * row_bytes);
+    }
+  }
+}
+
+static bool FrameRowSpan(int y, int* first_byte, int* end_byte) {
+  for (int i = 0; i < occupied_run_count; i++) {
+    if (y < occupied_runs[i].top) {
+      break;
+    }
+    if (y < occupied_runs[i].bottom) {
+      *first_byte = occupied_runs[i].first_byte;
+      *end_byte = occupied_runs[i].end_byte;
+      return true;
+    }
+  }
+  return false;
+}
+
+void RenderRows(unsigned char* band, int y, int rows) {
+  IndexFrame(false);
+  FillRows(band, y, rows);
+}
+
+bool RowSpan(int y, int* first_byte, int* end_byte) {
+  IndexFrame(false);
+  return FrameRowSpan(y, first_byte, end_byte);
+}
+
+void RenderDisplayedRows(unsigned char* band, int y, int rows) {
+  IndexFrame(true);
+  FillRows(band, y, rows);
+}
+
+bool DisplayedRowSpan(int y, int* first_byte, int* end_byte) {
+  IndexFrame(true);
+  return FrameRowSpan(y, first_byte, end_byte);
+}
+
+unsigned char printElements(bool, int x_byte, int y) {
+  if (y != row_cache_y) {
+    RenderRows(row_cache, y, 1);
+    row_cache_y = y;
+  }
+  return row_cache[x_byte];
+}
+
+// Grows box to cover top..bottom rows and byte columns first..end, clipped to
+// the panel. An empty box has top == bottom.
+static void GrowBox(LineState* box, int top, int bottom, int first_byte, int end_byte) {
+  top = top < 0 ? 0 : top;
+  bottom = bottom > EPD_HEIGHT ? EPD_HEIGHT : bottom;
+  first_byte = first_byte < 0 ? 0 : first_byte;
+  end_byte = end_byte > EPD_WIDTH/8 ? EPD_WIDTH/8 : end_byte;
+  if (top >= bottom || first_byte >= end_byte) {
+    return;
+  }
+  if (box->top == box->bottom) {
+    box->top = top;
+    box->bottom = bottom;
+    box->first_byte = first_byte;
+    box->end_byte = end_byte;
+    return;
+  }
+  box->top = min((int)box->top, top);
+  box->bottom = max((int)box->bottom, bottom);
+  box->first_byte = min((int)box->first_byte, first_byte);
+  box->end_byte = max((int)box->end_byte, end_byte);
+}
+
+// FNV-1a, folding in one element at a time.
+static uint32_t HashElement(uint32_t hash, const RenderElement* re) {
+  const uint8_t bytes[5] = {(uint8_t)re->x, (uint8_t)(re->x >> 8), (uint8_t)re->y, (uint8_t)(re->y >> 8), re->glyph};
+  for (int i = 0; i < 5; i++) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+void RenderLine(int slot, const Glyph* glyphs, int len, int x, int y) {
+  LineState* line = &lines[slot];
+  if (line->hash == 0) {
+    line->hash = 2166136261u;
+  }
+  int curr_x = x;
+  for (int i = 0; i < len; i++) {
+    if (render_element_count == kMaxRenderElements) {
+      render_overflow += len - i;
+      return;
+    }
+    RenderElement* el = &render_elements[render_element_count++];
+    el->x = curr_x;
+    el->y = y;
+    el->glyph = glyphs[i];
+    curr_x += GlyphAdvance(glyphs[i]);
+
+    line->hash = HashElement(line->hash, el);
+    GrowBox(line, ElementTop(el), ElementBottom(el), el->x >> 3, ((el->x + GlyphByteWidth(el->glyph)*8 - 1) >> 3) + 1);
+  }
+}
+
+int LineWidth(const Glyph* glyphs, int len) {
+  int width = 0;
+  for (int i = 0; i < len; i++) {
+    width += GlyphAdvance(glyphs[i]);
+  }
+  return width;
+}
+
+void RenderCentredLine(int slot, const Glyph* glyphs, int len, int y) {
+  RenderLine(slot, glyphs, len, 400 - LineWidth(glyphs, len)/2, y);
+}
+
+void RenderRightAlignedLine(int slot, const Glyph* glyphs, int len, int y) {
+  RenderLine(slot, glyphs, len, 800 - 55 - LineWidth(glyphs, len), y);
+}
+
+void ClearRenderElements() {
+  render_element_count = 0;
+  render_overflow = 0;
+  memset(lines, 0, sizeof(lines));
+}
+
+bool RenderDirtyWindow(int* x, int* y, int* width, int* height) {
+  LineState window = {};
+  for (int slot = 0; slot < kLineSlots; slot++) {
+    const LineState* now = &lines[slot];
+    const LineState* was = &displayed_lines[slot];
+    if (now->hash == was->hash) {
+      continue;
+    }
+    GrowBox(&window, now->top, now->bottom, now->first_byte, now->end_byte);
+    GrowBox(&window, was->top, was->bottom, was->first_byte, was->end_byte);
+  }
+  if (window.top == window.bottom) {
+    return false;
+  }
+  *x = window.first_byte * 8;
+  *width = (window.end_byte - window.first_byte) * 8;
+  *y = window.top;
+  *height = window.bottom - window.top;
+  return true;
+}
+
+uint32_t RenderFingerprint() {
+  uint32_t hash = 2166136261u;
+  for (int slot = 0; slot < kLineSlots; slot++) {
+    for (int i = 0; i < 4; i++) {
+      hash = (hash ^ (uint8_t)(lines[slot].hash >> (8*i))) * 16777619u;
+    }
+  }
+  return hash;
+}
+
+void MarkRenderDisplayed() {
+  memcpy(displayed_lines, lines, sizeof(lines));
+  memcpy(displayed_elements, render_elements, render_element_count * sizeof(RenderElement));
+  displayed_element_count = render_element_count;
+  if (indexed_displayed) {
+    // The index was over the list just overwritten.
+    IndexRenderElements(render_elements, render_element_count);
+    indexed_displayed = false;
+  }
+}
+
+int RenderBusDescs(BusDescription* descs, int count, int status, const char* data_time) {
+  ClearRenderElements();
+  DEBUG_PRINT("RenderBusDescs with count ");
+  DEBUG_PRINTLN(count);
+  if (count > 7) {
+    count = 7;
+  }
+  for (int i = 0; i < count; i++) {
+    Glyph line[30];
+    int el_idx = 0;
+    for (int j = 0; j < 3; j++) {
+      line[el_idx++] = DIGITS[descs[i].number[j] - '0'];
+    }
+    line[el_idx++] = SEP;
+
+    // Blank when there's no clock to count from.
+    if (descs[i].mins[0] != ' ') {
+      for (int j = 0; j < 2; j++) {
+        line[el_idx++] = DIGITS[descs[i].mins[j] - '0'];
+      }
+      line[el_idx++] = MINS;
+    }
+  //  line[el_idx++] = SEP;
+
+    for (int j = 0; j < 5; j++) {
+      if (descs[i].time[j] == ':') {
+        line[el_idx++] = COLON_LIGHT;
+      } else {
+        line[el_idx++] = DIGITS_LIGHT[descs[i].time[j] - '0'];
+      }
+    }
+    line[el_idx++] = SEP;
+
+    const Stop* stop = findStop(descs[i].stop_id);
+    if (stop != nullptr) {
+      line[el_idx++] = stop->label;
+    }
+
+    RenderCentredLine(i, line, el_idx, (i+1) * (DIGIT_HEIGHT+5) + 50);
+  }
+
+  int battery_percentage = readBatteryPercent();
+
+  const int bottom_line_y = 450;
+
+  if(status != 0) {
+    bool neg = status < 0;
+    status = status < 0 ? -1 * status : status;
+    int status_els = 0;
+    Glyph status_line[15];
+    status_line[status_els++] = STATUS;
+    if (neg) {
+      status_line[status_els++] = SEP;
+    }
+    if (status >= 1000) {
+      status_line[status_els++] = DIGITS_SMALL[(status / 1000) % 10];
+    }
+    if (status >= 100) {
+      status_line[status_els++] = DIGITS_SMALL[(status / 100) % 10];
+    }
+    if (status >= 10) {
+      status_line[status_els++] = DIGITS_SMALL[(status / 10) % 10];
+    }
+    status_line[status_els++] = DIGITS_SMALL[status % 10];
+    if (data_time) {
+      // When the departures above were fetched.
+      status_line[status_els++] = SEP;
+      for (int j = 0; j < 5; j++) {
+        status_line[status_els++] = data_time[j] == ':' ? COLON_SMALL : DIGITS_SMALL[data_time[j] - '0'];
+      }
+    }
+    RenderCentredLine(kStatusSlot, status_line, status_els, bottom_line_y);
+  }
+  
+  if (battery_percentage >= 0) {
+    int batt_els = 0;
+    Glyph batt_line[9];
+    if (battery_percentage >= 100) {
+      batt_line[batt_els++] = DIGITS_SMALL[battery_percentage / 100];
+    }
+    batt_line[batt_els++] = DIGITS_SMALL[(battery_percentage / 10) % 10];
+    batt_line[batt_els++] = DIGITS_SMALL[battery_percentage % 10];
+    batt_line[batt_els++] = PERCENT;
+    RenderRightAlignedLine(kBatterySlot, batt_line, batt_els, bottom_line_y);
+  }
+
+  if (render_overflow) {
+    Serial.print("Display list full, dropped elements: ");
+    Serial.println(render_overflow);
+  }
+
+  IndexRenderElements(render_elements, render_element_count);
+  indexed_displayed = false;
+  return render_overflow;
+}
@@ -0,0 +1,40 @@
+#ifndef render_h
+#define render_h
+
+#include "bus_description.h"
+
+// Lays out departure lines, the status code and battery level as a list of
+// glyph elements, ready to be scanned out with printElements(). Returns the
+// number of elements that didn't fit in the display list (0 on success).
+int RenderBusDescs(BusDescription* descs, int count, int status, const char* data_time = nullptr);
+
+// Finds the smallest window covering every line whose content changed since
+// MarkRenderDisplayed() was last called, in pixels with x and width multiples
+// of 8. Returns false if nothing changed.
+bool RenderDirtyWindow(int* x, int* y, int* width, int* height);
+
+// Fingerprint of the whole frame, folded from the per-line hashes. Equal
+// fingerprints mean nothing visible changed.
+uint32_t RenderFingerprint();
+
+// Records the current frame as the one on the panel.
+void MarkRenderDisplayed();
+
+// Epd::DisplayRows callback. Renders rows y to y + rows - 1 into band, one
+// EPD_WIDTH/8 byte scanline after another.
+void RenderRows(unsigned char* band, int y, int rows);
+
+// Epd::DisplayRows span callback. Returns false if row y is blank, otherwise
+// sets [first_byte, end_byte) to the byte columns that may hold ink.
+bool RowSpan(int y, int* first_byte, int* end_byte);
+
+// As RenderRows() and RowSpan(), but for the frame last marked displayed. Used
+// for the old data of a partial refresh.
+void RenderDisplayedRows(unsigned char* band, int y, int rows);
+bool DisplayedRowSpan(int y, int* first_byte, int* end_byte);
+
+// Epd::DisplayBytes callback. Renders a row at a time through RenderRows(), so
+// it is cheapest when called in scan order.
+unsigned char printElements(bool last_in_line, int x_byte, int y);
+
+#endif
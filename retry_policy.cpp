@@ -0,0 +1,87 @@
+#include <Arduino.h>
+
+#include "retry_policy.h"
+#include "http_connection.h"
+#include "logging.h"
+
+// Kept in RAM, which LowPower.deepSleep() (standby on the SAMD21) preserves,
+// so the history carries over from one wake to the next.
+static int failed_cycles = 0;
+static int wakes_to_skip = 0;
+static int retries_left = 0;
+// Stops fetched so far this cycle.
+static int stops_fetched = 0;
+
+bool isTransientError(int result) {
+  switch (result) {
+  case -1:  // connect failed
+  case -2:  // write failed
+  case -3:  // too many requests in flight
+  case -6:  // out of memory
+  case kBodyTruncated:
+  case kConnectionLost:
+  case 408:
+  case 429:
+  case 1006:  // Too many requests per minute
+  case 5321:  // Unable to call the underlying API
+  case 5322:
+  case 5323:
+    return true;
+  default:
+    return result >= 500 && result < 600;
+  }
+}
+
+bool retryCycleBegin() {
+  if (wakes_to_skip > 0) {
+    wakes_to_skip--;
+    Serial.print("Backing off after ");
+    Serial.print(failed_cycles);
+    Serial.print(" failed cycles, wakes left to skip: ");
+    Serial.println(wakes_to_skip);
+    return false;
+  }
+  // Straight after a failed cycle, allow one retry rather than the full
+  // budget in case it's still down.
+  retries_left = failed_cycles ? 1 : kRetryBudget;
+  stops_fetched = 0;
+  return true;
+}
+
+bool retryAllowed(int result, int failures, unsigned long* delay_ms) {
+  if (!isTransientError(result)) {
+    DEBUG_PRINT("Not retrying permanent error ");
+    DEBUG_PRINTLN(result);
+    return false;
+  }
+  if (retries_left == 0) {
+    DEBUG_PRINTLN("Retry budget used up");
+    return false;
+  }
+  retries_left--;
+  *delay_ms = kRetryDelayMs << (failures > 1 ? failures - 1 : 0);
+  if (*delay_ms > kMaxRetryDelayMs) {
+    *delay_ms = kMaxRetryDelayMs;
+  }
+  return true;
+}
+
+void retryStopDone(int result) {
+  if (result == 0) {
+    stops_fetched++;
+  }
+}
+
+void retryCycleEnd() {
+  // One stop failing, however it failed, doesn't make the API look down
+  // while the others work; its cached departures are used meanwhile.
+  if (stops_fetched > 0) {
+    failed_cycles = 0;
+    wakes_to_skip = 0;
+    return;
+  }
+  failed_cycles++;
+  // 0, 1, 3, 6, 6... wakes skipped after each failed cycle in a row.
+  int skip = (1 << (failed_cycles - 1)) - 1;
+  wakes_to_skip = skip < kMaxSkippedWakes && failed_cycles < 8 ? skip : kMaxSkippedWakes;
+}
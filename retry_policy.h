@@ -0,0 +1,35 @@
+#ifndef retry_policy_h
+#define retry_policy_h
+
+// Retries shared by all the stops in one cycle.
+const int kRetryBudget = 3;
+// Wait before a stop's first retry, doubled for each one after.
+const unsigned long kRetryDelayMs = 500;
+const unsigned long kMaxRetryDelayMs = 4000;
+// Most wakes skipped in a row while the API keeps failing.
+const int kMaxSkippedWakes = 6;
+
+// Whether an error from a stop query might go away if asked again soon:
+// network failures, timeouts, HTTP 5xx and 429, and the SL StatusCodes for
+// rate limiting and backend trouble. Anything else (a bad key, a malformed
+// response, other 4xx) will fail the same way next time.
+bool isTransientError(int result);
+
+// Starts a wake's network cycle. Returns false if recent cycles failed and
+// this wake should leave the radio off.
+bool retryCycleBegin();
+
+// Whether a stop that has failed failures times, the last with result, may be
+// asked again this cycle. If so one retry is taken from the cycle's budget
+// and *delay_ms says how long to wait first.
+bool retryAllowed(int result, int failures, unsigned long* delay_ms);
+
+// Records how one stop's query ended this cycle, 0 for success.
+void retryStopDone(int result);
+
+// Records how the cycle went so later wakes can back off. The cycle failed
+// only if no stop was fetched, so a stop that keeps failing, say with a 404,
+// doesn't keep the radio off for the stops that work.
+void retryCycleEnd();
+
+#endif
@@ -0,0 +1,10 @@
+#include "stops.h"
+
+const Stop* findStop(int stop_id) {
+  for (int stop = 0; stop < kStops; stop++) {
+    if (kStopTable[stop].id == stop_id) {
+      return &kStopTable[stop];
+    }
+  }
+  return nullptr;
+}
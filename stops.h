@@ -0,0 +1,25 @@
+#ifndef stops_h
+#define stops_h
+
+#include "imagedata.h"
+
+// A stop we show departures from.
+struct Stop {
+  int id;
+  // Departures sooner than this can't be reached from home in time.
+  int minimum_mins;
+  // Shown after each departure from the stop.
+  Glyph label;
+};
+
+const Stop kStopTable[] = {
+  {4010, 3, TORGET},
+  {4028, 5, STUGAN},
+  {4027, 15, SKOLAN},
+};
+const int kStops = sizeof(kStopTable) / sizeof(kStopTable[0]);
+
+// The table entry for stop_id, or nullptr if it isn't one of ours.
+const Stop* findStop(int stop_id);
+
+#endif
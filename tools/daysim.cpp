@@ -0,0 +1,416 @@
+// daysim: runs the sketch's fetch, departure cache and wake decisions over
+// simulated time against a fake SL server with a fixed timetable, and checks
+// what the board would show at every wake.
+//
+//   daysim [-v] <scenario>
+//
+// Scenarios:
+//   timetable   24 wakes five minutes apart from 07:30, which should mostly
+//               count down from the cache rather than fetch
+//   outage      wakes five minutes apart through a server outage and then a
+//               stop that is always refused, keeping the cached departures
+//               up throughout
+//   day         a whole day from 05:00, sleeping as long as the sketch's wake
+//               scheduler says
+//   reset       a fresh start that finds the departures outage left in
+//               flash, which needs HOST_FLASH set for both runs
+//
+// Prints one line per check and exits non-zero if any failed. -v passes the
+// sketch's Serial output through.
+
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include <Arduino.h>
+#include <WiFiNINA.h>
+
+#include "../bus_description.h"
+#include "../departure_cache.h"
+#include "../network.h"
+#include "../retry_policy.h"
+#include "../stops.h"
+#include "../wake_scheduler.h"
+#include "../wall_clock.h"
+
+namespace {
+
+bool verbose = false;
+unsigned long now_ms = 0;
+int failures = 0;
+
+// Simulated time starts at 00:00 on 2022-03-01 plus this many seconds.
+long start_secs = 0;
+
+long SimSecs() {
+  return start_secs + (long)(now_ms / 1000);
+}
+
+std::string Clock(long secs) {
+  char text[48];
+  snprintf(text, sizeof(text), "2022-03-%02ld %02ld:%02ld:%02ld", 1 + secs / 86400, secs / 3600 % 24,
+           secs / 60 % 60, secs % 60);
+  return text;
+}
+
+// ExpectedDateTime and LatestUpdate form
+std::string ApiClock(long secs) {
+  std::string text = Clock(secs);
+  text[10] = 'T';
+  return text;
+}
+
+// Every stop has a bus every 12 minutes from 06:00 to 22:00 and every 30
+// minutes either side, with none from 00:30 to 05:30. Stops are a few
+// minutes apart.
+bool Departs(int stop, long secs) {
+  long day_secs = secs % 86400 - stop * 4 * 60;
+  if (day_secs < 0 || day_secs % 60 != 0) {
+    return false;
+  }
+  long mins = day_secs / 60;
+  if (mins >= 6 * 60 && mins < 22 * 60) {
+    return mins % 12 == 0;
+  }
+  if (mins < 30 || mins >= 5 * 60 + 30) {
+    return mins % 30 == 0;
+  }
+  return false;
+}
+
+int StopIndex(int stop_id) {
+  for (int stop = 0; stop < kStops; stop++) {
+    if (kStopTable[stop].id == stop_id) {
+      return stop;
+    }
+  }
+  return -1;
+}
+
+// The fake server's state.
+struct Server {
+  std::string request;
+  std::string out;
+  bool open;
+  int connects;
+  // Refuses connections.
+  bool down;
+  // Stop answered with a 404, as an unknown stop id would be, -1 for none.
+  int refused_stop;
+} server;
+
+std::string Body(int stop) {
+  long now = SimSecs();
+  std::string body = "{\"StatusCode\":0,\"Message\":null,\"ExecutionTime\":12,\"ResponseData\":{\"LatestUpdate\":\"" +
+                     ApiClock(now) + "\",\"DataAge\":0,\"Metros\":[],\"Buses\":[";
+  bool first = true;
+  // The sketch asks for a 60 minute window.
+  for (long t = now - now % 60 + 60; t <= now + 60 * 60; t += 60) {
+    if (!Departs(stop, t)) {
+      continue;
+    }
+    char bus[256];
+    snprintf(bus, sizeof(bus),
+             "%s{\"LineNumber\":\"5%02d\",\"Destination\":\"Centrum\",\"JourneyDirection\":2,"
+             "\"ExpectedDateTime\":\"%s\",\"JourneyNumber\":%ld}",
+             first ? "" : ",", stop, ApiClock(t).c_str(), t / 60);
+    body += bus;
+    first = false;
+  }
+  return body + "],\"Trains\":[],\"Trams\":[],\"Ships\":[]}}";
+}
+
+// Answers every complete request written so far, in order.
+void Serve() {
+  size_t end;
+  while ((end = server.request.find("\r\n\r\n")) != std::string::npos) {
+    std::string request = server.request.substr(0, end);
+    server.request.erase(0, end + 4);
+    size_t site = request.find("siteid=");
+    int stop = site == std::string::npos ? -1 : StopIndex(atoi(request.c_str() + site + 7));
+    if (stop < 0 || stop == server.refused_stop) {
+      server.out += "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n";
+      continue;
+    }
+    std::string body = Body(stop);
+    server.out += "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: " +
+                  std::to_string(body.size()) + "\r\n\r\n" + body;
+  }
+}
+
+// One wake of the sketch's loop, deciding whether to fetch the way
+// refreshDisplay() does. Returns whether it fetched; *status is what the
+// board would show as the last error.
+bool Wake(int* status) {
+  if (departureCacheUsable()) {
+    *status = 0;
+    return false;
+  }
+  if (inQuietHours() || !retryCycleBegin()) {
+    return false;
+  }
+  *status = connectWifi();
+  if (*status == 0) {
+    *status = queryWebService();
+  }
+  endWifi();
+  retryCycleEnd();
+  return true;
+}
+
+// Checks what the board shows at a wake: every departure still catchable
+// from its stop, and its minutes counted from the time now.
+std::string CheckBoard(const BusResults& shown) {
+  long now = wallClockNow();
+  for (int i = 0; i < shown.len; i++) {
+    const BusDescription& desc = shown.descs[i];
+    long left = desc.expected - now;
+    int mins = (desc.mins[0] - '0') * 10 + desc.mins[1] - '0';
+    if (left < findStop(desc.stop_id)->minimum_mins * 60L || mins != left / 60 % 100) {
+      char text[80];
+      snprintf(text, sizeof(text), " %.5s from %d shown as %.2s at %s", desc.time, desc.stop_id, desc.mins,
+               Clock(SimSecs()).c_str() + 11);
+      return text;
+    }
+  }
+  return "";
+}
+
+void Report(bool ok, const char* scenario, const std::string& detail) {
+  printf("%s\t%s\t%s\n", ok ? "ok" : "FAIL", scenario, detail.c_str());
+  failures += !ok;
+}
+
+// With a 60 minute window cached, most of the five-minute wakes count down
+// from the cache.
+void RunTimetable() {
+  start_secs = 7 * 3600 + 30 * 60;
+  int fetches = 0;
+  std::string problems;
+  for (int wake = 0; wake < 24; wake++) {
+    int status = 0;
+    fetches += Wake(&status);
+    BusResults shown = cachedDepartures();
+    if (status != 0) {
+      problems += " status " + std::to_string(status);
+    }
+    if (shown.len == 0) {
+      problems += " nothing shown at " + Clock(SimSecs()).substr(11);
+    }
+    problems += CheckBoard(shown);
+    free(shown.descs);
+    delay(5 * 60 * 1000UL);
+  }
+  Report(fetches == 4 && problems.empty(), "timetable", std::to_string(fetches) + " of 24 wakes fetched" + problems);
+}
+
+// Through an outage the board keeps counting down from what it has and
+// says how old it is, and a stop that is always refused neither blanks the
+// board nor makes every wake fetch.
+void RunOutage() {
+  start_secs = 7 * 3600 + 30 * 60;
+  std::string problems;
+  int fetches_refused = 0;
+  bool said_when = false;
+  bool recovered = false;
+  for (int wake = 0; wake < 48; wake++) {
+    long now = SimSecs();
+    server.down = now >= 7 * 3600 + 40 * 60 && now < 9 * 3600 + 10 * 60;
+    server.refused_stop = now >= 9 * 3600 + 30 * 60 ? kStops - 1 : -1;
+    int status = 0;
+    bool fetched = Wake(&status);
+    BusResults shown = cachedDepartures();
+    problems += CheckBoard(shown);
+    char fetched_time[6] = {};
+    if (server.down && status != 0) {
+      // The status line gives the time of the last good fetch, 07:30.
+      said_when = departureCacheFetchedTime(fetched_time) && strcmp(fetched_time, "07:30") == 0;
+      if (!said_when) {
+        problems += " data time " + std::string(fetched_time) + " at " + Clock(now).substr(11);
+      }
+    }
+    // Backing off may put off the first fetch after the outage a little.
+    recovered |= now >= 9 * 3600 + 10 * 60 && fetched && status == 0;
+    if (now >= 9 * 3600 + 30 * 60 && !recovered) {
+      problems += " not fetched again by " + Clock(now).substr(11);
+    }
+    if ((now < 7 * 3600 + 40 * 60 || recovered) && shown.len == 0) {
+      problems += " nothing shown at " + Clock(now).substr(11);
+    }
+    if (server.refused_stop >= 0) {
+      fetches_refused += fetched;
+      for (int i = 0; i < shown.len; i++) {
+        if (shown.descs[i].stop_id == kStopTable[server.refused_stop].id && shown.descs[i].expected < now) {
+          problems += " gone departure shown";
+        }
+      }
+    }
+    free(shown.descs);
+    delay(5 * 60 * 1000UL);
+  }
+  // The refused stop is left out of the cache's freshness, so the others
+  // are fetched about as often as on the timetable.
+  bool ok = problems.empty() && said_when && fetches_refused <= 4;
+  Report(ok, "outage", std::to_string(fetches_refused) + " of 24 wakes fetched with a stop refused" + problems);
+}
+
+// A whole day on the wake scheduler: every departure shown is still
+// catchable, none goes while it's on the board, and there are fewer wakes
+// than the 288 a fixed five minute sleep gives.
+void RunDay() {
+  start_secs = 5 * 3600;
+  int wakes = 0;
+  int fetches = 0;
+  std::string problems;
+  while (SimSecs() < start_secs + 86400) {
+    wakes++;
+    int status = 0;
+    fetches += Wake(&status);
+    BusResults shown = cachedDepartures();
+    problems += CheckBoard(shown);
+    unsigned long sleep_ms = nextWakeMillis();
+    long now = wallClockNow();
+    // The board has seven lines.
+    for (int i = 0; i < shown.len && i < 7; i++) {
+      const BusDescription& desc = shown.descs[i];
+      if (desc.expected - (long)(sleep_ms / 1000) < now + findStop(desc.stop_id)->minimum_mins * 60L / 2) {
+        problems += " " + std::string(desc.time, 5) + " from " + std::to_string(desc.stop_id) + " still shown at " +
+                    Clock(SimSecs() + sleep_ms / 1000).substr(11);
+      }
+    }
+    free(shown.descs);
+    delay(sleep_ms);
+  }
+  Report(problems.empty() && wakes < 288, "day",
+         std::to_string(wakes) + " wakes, " + std::to_string(fetches) + " fetches" + problems);
+}
+
+// After a reset the clock is unknown, so the departures from flash are shown
+// with their minutes blank until the first fetch sets it.
+void RunReset() {
+  start_secs = 13 * 3600;
+  std::string problems;
+  if (!departureCacheLoad()) {
+    problems += " nothing in flash";
+  }
+  BusResults shown = cachedDepartures();
+  if (shown.len == 0) {
+    problems += " nothing shown";
+  }
+  for (int i = 0; i < shown.len; i++) {
+    if (shown.descs[i].mins[0] != ' ' || shown.descs[i].mins[1] != ' ') {
+      problems += " minutes shown without a clock";
+      break;
+    }
+  }
+  free(shown.descs);
+
+  int status = 0;
+  if (!Wake(&status) || status != 0) {
+    problems += " first wake didn't fetch";
+  }
+  shown = cachedDepartures();
+  problems += CheckBoard(shown);
+  if (shown.len == 0) {
+    problems += " nothing shown after fetching";
+  }
+  free(shown.descs);
+  Report(problems.empty(), "reset", "departures from flash shown until the first fetch" + problems);
+}
+
+}  // namespace
+
+// The fake server's side of the socket. Responses are queued as the requests
+// arrive and handed out whole.
+
+int WiFiSSLClient::connect(const char*, uint16_t) {
+  if (server.down) {
+    return 0;
+  }
+  server.open = true;
+  server.connects++;
+  server.request.clear();
+  server.out.clear();
+  return 1;
+}
+
+size_t WiFiSSLClient::write(const uint8_t* buf, size_t size) {
+  if (!server.open) {
+    return 0;
+  }
+  server.request.append((const char*)buf, size);
+  Serve();
+  return size;
+}
+
+int WiFiSSLClient::available() {
+  now_ms++;
+  return server.out.size();
+}
+
+int WiFiSSLClient::read(uint8_t* buf, size_t size) {
+  size_t n = size < server.out.size() ? size : server.out.size();
+  memcpy(buf, server.out.data(), n);
+  server.out.erase(0, n);
+  return n;
+}
+
+void WiFiSSLClient::stop() {
+  server.open = false;
+  server.out.clear();
+}
+
+uint8_t WiFiSSLClient::connected() {
+  return server.open || !server.out.empty();
+}
+
+WiFiClass WiFi;
+
+// Arduino, as the sketch sees it.
+
+HostSerial Serial;
+
+void HostSerial::print(const char* s) { if (verbose) fputs(s, stdout); }
+void HostSerial::print(char c) { if (verbose) putchar(c); }
+void HostSerial::print(long n, int) { if (verbose) printf("%ld", n); }
+void HostSerial::print(unsigned long n, int) { if (verbose) printf("%lu", n); }
+void HostSerial::print(double n) { if (verbose) printf("%g", n); }
+
+unsigned long millis() { return now_ms; }
+unsigned long micros() { return now_ms * 1000; }
+void delay(unsigned long ms) { now_ms += ms; }
+void delayMicroseconds(unsigned int) {}
+void pinMode(int, int) {}
+void digitalWrite(int, int) {}
+int digitalRead(int) { return 0; }
+
+int main(int argc, char** argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "v")) != -1) {
+    switch (opt) {
+    case 'v': verbose = true; break;
+    default:
+      optind = argc + 1;
+    }
+  }
+  if (optind != argc - 1) {
+    fprintf(stderr, "usage: daysim [-v] timetable|outage|day|reset\n");
+    return 2;
+  }
+  std::string scenario = argv[optind];
+  server.refused_stop = -1;
+  if (scenario == "timetable") {
+    RunTimetable();
+  } else if (scenario == "outage") {
+    RunOutage();
+  } else if (scenario == "day") {
+    RunDay();
+  } else if (scenario == "reset") {
+    RunReset();
+  } else {
+    fprintf(stderr, "daysim: no scenario %s\n", scenario.c_str());
+    return 2;
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,539 @@
+// epdsim: runs the sketch's renderer and panel driver on the host against a
+// simulated EpdIf. The simulation decodes the SPI command stream the way the
+// panel's UC8179 controller would, with a timing model for the SPI link and
+// the panel's busy periods. It writes what the panel ends up showing as PBM.
+//
+//   epdsim [options] <frame> [<frame> ...]
+//
+// Each frame file lists departures, one per line as
+// "<line> <HH:MM> <mins> <stop id>" (e.g. "123 07:15 05 4010"). It may also
+// have "status <code>" and "battery <percent>" lines. Frames go to the panel
+// through the sketch's own showRender(), so the first is a full refresh and
+// later ones get a partial window, the fast waveform or a periodic full
+// refresh as on the device, or are skipped if nothing changed.
+//
+// Options:
+//   -o <prefix>   write the panel after frame n to <prefix><n>.pbm
+//   -f            full refresh on every frame
+//   -t <celsius>  panel temperature sensor reading (default 20)
+//   -c <hz>       SPI clock (default 7000000)
+//   -g <us>       overhead of a single-byte transfer, toggling CS and DC
+//                 (default 1.5); blocks pay it once
+//   -b <full>,<fast>,<partial>
+//                 refresh busy time per waveform in ms (default 3500,1500,400)
+//   -v            show the driver's serial log
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include <Arduino.h>
+#include <ArduinoLowPower.h>
+
+#include "../bus_description.h"
+#include "../epd7in5_V2.h"
+#include "../panel_refresh.h"
+#include "../render.h"
+
+namespace {
+
+const int kRowBytes = EPD_WIDTH / 8;
+const int kFrameBytes = kRowBytes * EPD_HEIGHT;
+
+[[noreturn]] void Fail(const std::string& message) {
+  fprintf(stderr, "epdsim: %s\n", message.c_str());
+  exit(1);
+}
+
+struct Timing {
+  double spi_hz = 7000000;
+  double call_overhead_us = 1.5;
+  double full_ms = 3500;
+  double fast_ms = 1500;
+  double partial_ms = 400;
+  double power_on_ms = 40;
+  double power_off_ms = 20;
+};
+
+Timing timing;
+bool verbose = false;
+int temperature = 20;
+int battery_percent = 87;
+
+// Simulated time, in microseconds since start.
+double now_us = 0;
+
+// Totals the per-frame report is worked out from.
+struct Stats {
+  double spi_us = 0;
+  double busy_us = 0;
+  unsigned long bytes = 0;
+  // Status commands (0x71) sent while waiting for BUSY, not counted above
+  unsigned long polls = 0;
+  int refreshes = 0;
+};
+
+Stats stats;
+
+void Warn(const std::string& message) {
+  fprintf(stderr, "epdsim: warning: %s\n", message.c_str());
+}
+
+// The parts of the UC8179 the driver uses: the two frame memories, the
+// partial window, the LUT and temperature settings that pick a waveform, and
+// the BUSY line.
+class Controller {
+public:
+  Controller() { Reset(); memset(panel_, 0, sizeof(panel_)); }
+
+  void Pin(int pin, int value) {
+    if (pin == DC_PIN) {
+      dc_ = value;
+    } else if (pin == CS_PIN) {
+      cs_ = value;
+    } else if (pin == RST_PIN && !value) {
+      Reset();
+    }
+  }
+
+  bool Idle() const { return now_us >= busy_until_; }
+  double busy_until() const { return busy_until_; }
+
+  // Returns true if the byte was a status poll.
+  bool Byte(unsigned char byte) {
+    if (cs_) {
+      Warn("byte sent with CS high");
+      return false;
+    }
+    if (asleep_) {
+      if (!warned_asleep_) {
+        Warn("controller is in deep sleep until reset, ignoring bytes");
+        warned_asleep_ = true;
+      }
+      return false;
+    }
+    if (!dc_) {
+      Command(byte);
+      return byte == 0x71;
+    }
+    Data(byte);
+    return false;
+  }
+
+  unsigned char Read() {
+    if (command_ != 0x40) {
+      return 0xFF;
+    }
+    return data_index_++ == 0 ? (unsigned char)temperature : 0x00;
+  }
+
+  const unsigned char* panel() const { return panel_; }
+
+private:
+  void Reset() {
+    asleep_ = false;
+    warned_asleep_ = false;
+    partial_ = false;
+    panel_setting_ = 0x0F;
+    vcom_interval_ = 0x10;
+    cascade_ = 0;
+    forced_temperature_ = 0;
+    lut_bytes_ = 0;
+    command_ = -1;
+    SetWindow(0, kRowBytes - 1, 0, EPD_HEIGHT - 1);
+    memset(old_ram_, 0, sizeof(old_ram_));
+    memset(new_ram_, 0, sizeof(new_ram_));
+  }
+
+  void SetWindow(int first_byte, int last_byte, int top, int bottom) {
+    win_first_ = first_byte;
+    win_last_ = last_byte;
+    win_top_ = top;
+    win_bottom_ = bottom;
+  }
+
+  void Busy(double ms) {
+    busy_until_ = now_us + ms * 1000;
+    stats.busy_us += ms * 1000;
+  }
+
+  void Command(unsigned char command) {
+    command_ = command;
+    data_index_ = 0;
+    ram_pos_ = 0;
+    switch (command) {
+    case 0x04:  // power on
+      Busy(timing.power_on_ms);
+      break;
+    case 0x02:  // power off
+      Busy(timing.power_off_ms);
+      break;
+    case 0x12:
+      Refresh();
+      break;
+    case 0x91:
+      partial_ = true;
+      break;
+    case 0x92:
+      partial_ = false;
+      break;
+    }
+  }
+
+  void Data(unsigned char byte) {
+    int index = data_index_++;
+    switch (command_) {
+    case 0x00:
+      if (index == 0) {
+        panel_setting_ = byte;
+      }
+      break;
+    case 0x07:
+      if (byte == 0xA5) {
+        // Deep sleep loses both frame memories; the panel keeps its image.
+        asleep_ = true;
+        memset(old_ram_, 0, sizeof(old_ram_));
+        memset(new_ram_, 0, sizeof(new_ram_));
+      }
+      break;
+    case 0x10:
+      WriteRam(old_ram_, byte);
+      break;
+    case 0x13:
+      WriteRam(new_ram_, byte);
+      break;
+    case 0x20: case 0x21: case 0x22: case 0x23: case 0x24:
+      lut_bytes_++;
+      break;
+    case 0x50:
+      if (index == 0) {
+        vcom_interval_ = byte;
+      }
+      break;
+    case 0x90:
+      if (index < 9) {
+        window_[index] = byte;
+      }
+      if (index == 7) {
+        int hrst = (window_[0] << 8 | window_[1]) & ~7;
+        int hred = (window_[2] << 8 | window_[3]) | 7;
+        int vrst = window_[4] << 8 | window_[5];
+        int vred = window_[6] << 8 | window_[7];
+        if (hred >= EPD_WIDTH || vred >= EPD_HEIGHT || hrst > hred || vrst > vred) {
+          Warn("partial window out of range");
+          break;
+        }
+        SetWindow(hrst / 8, hred / 8, vrst, vred);
+      }
+      break;
+    case 0xE0:
+      cascade_ = byte;
+      break;
+    case 0xE5:
+      forced_temperature_ = byte;
+      break;
+    }
+  }
+
+  // Frame memory writes fill the partial window in partial mode, otherwise
+  // the whole frame, a row at a time.
+  void WriteRam(unsigned char* ram, unsigned char byte) {
+    int first = partial_ ? win_first_ : 0;
+    int last = partial_ ? win_last_ : kRowBytes - 1;
+    int top = partial_ ? win_top_ : 0;
+    int bottom = partial_ ? win_bottom_ : EPD_HEIGHT - 1;
+    int width = last - first + 1;
+    int row = top + ram_pos_ / width;
+    int col = first + ram_pos_ % width;
+    ram_pos_++;
+    if (row > bottom) {
+      if (row == bottom + 1 && col == first) {
+        Warn("more data than the frame memory window holds");
+      }
+      return;
+    }
+    ram[row * kRowBytes + col] = byte;
+  }
+
+  void Refresh() {
+    stats.refreshes++;
+    const char* waveform = "full";
+    double ms = timing.full_ms;
+    if (panel_setting_ & 0x20) {
+      if (lut_bytes_ < 5 * 42) {
+        Warn("refresh with an incomplete register LUT");
+      }
+    } else if (cascade_ & 0x02) {
+      if (forced_temperature_ == 0x5A) {
+        waveform = "fast";
+        ms = timing.fast_ms;
+      } else if (forced_temperature_ == 0x6E) {
+        waveform = "partial";
+        ms = timing.partial_ms;
+      }
+    }
+
+    int first = partial_ ? win_first_ : 0;
+    int last = partial_ ? win_last_ : kRowBytes - 1;
+    int top = partial_ ? win_top_ : 0;
+    int bottom = partial_ ? win_bottom_ : EPD_HEIGHT - 1;
+    // The OTP fast and partial waveforms drive each pixel by its old and
+    // new values, so old data that doesn't match the panel leaves ghosts
+    // behind. The full register LUT drives every pixel the same either way.
+    bool uses_old = !(panel_setting_ & 0x20);
+    int stale = 0;
+    for (int y = top; y <= bottom; y++) {
+      for (int x = first; x <= last; x++) {
+        int i = y * kRowBytes + x;
+        if (uses_old && old_ram_[i] != panel_[i]) {
+          stale++;
+        }
+        panel_[i] = new_ram_[i];
+        if (vcom_interval_ & 0x08) {
+          old_ram_[i] = new_ram_[i];
+        }
+      }
+    }
+    if (stale) {
+      Warn(std::string(waveform) + " refresh with " + std::to_string(stale) +
+           " bytes of old data not matching the panel");
+    }
+    if (verbose) {
+      printf("[epdsim] %s refresh of %dx%d at %d,%d, %s waveform\n", partial_ ? "partial" : "full",
+             (last - first + 1) * 8, bottom - top + 1, first * 8, top, waveform);
+    }
+    Busy(ms);
+  }
+
+  unsigned char old_ram_[kFrameBytes];
+  unsigned char new_ram_[kFrameBytes];
+  unsigned char panel_[kFrameBytes];
+  double busy_until_ = 0;
+  int dc_ = 1;
+  int cs_ = 1;
+  bool asleep_;
+  bool warned_asleep_;
+  bool partial_;
+  unsigned char panel_setting_;
+  unsigned char vcom_interval_;
+  unsigned char cascade_;
+  unsigned char forced_temperature_;
+  int lut_bytes_;
+  int command_;
+  int data_index_ = 0;
+  long ram_pos_ = 0;
+  unsigned char window_[9] = {};
+  int win_first_, win_last_, win_top_, win_bottom_;
+};
+
+Controller controller;
+
+void SpiTime(unsigned long bytes, int calls, bool poll = false) {
+  double us = bytes * 8 * 1e6 / timing.spi_hz + calls * timing.call_overhead_us;
+  now_us += us;
+  if (poll) {
+    stats.polls++;
+    return;
+  }
+  stats.spi_us += us;
+  stats.bytes += bytes;
+}
+
+struct Frame {
+  std::vector<BusDescription> descs;
+  int status = 0;
+  int battery = 87;
+};
+
+Frame ReadFrame(const std::string& path) {
+  std::ifstream in(path);
+  if (!in) {
+    Fail("can't open " + path);
+  }
+  Frame frame;
+  std::string line;
+  for (int line_number = 1; std::getline(in, line); line_number++) {
+    std::istringstream words(line.substr(0, line.find('#')));
+    std::string first;
+    if (!(words >> first)) {
+      continue;
+    }
+    std::string where = path + ":" + std::to_string(line_number);
+    if (first == "battery") {
+      if (!(words >> frame.battery)) {
+        Fail(where + ": expected battery <percent>");
+      }
+      continue;
+    }
+    if (first == "status") {
+      if (!(words >> frame.status)) {
+        Fail(where + ": expected status <code>");
+      }
+      continue;
+    }
+    std::string time, mins;
+    BusDescription desc = {};
+    if (!(words >> time >> mins >> desc.stop_id) || first.size() != 3 || time.size() != 5 || mins.size() != 2) {
+      Fail(where + ": expected <line> <HH:MM> <mins> <stop id>");
+    }
+    memcpy(desc.number, first.data(), 3);
+    memcpy(desc.time, time.data(), 5);
+    memcpy(desc.mins, mins.data(), 2);
+    frame.descs.push_back(desc);
+  }
+  return frame;
+}
+
+void WritePbm(const std::string& path, const unsigned char* frame) {
+  FILE* out = fopen(path.c_str(), "wb");
+  if (!out) {
+    Fail("can't write " + path);
+  }
+  fprintf(out, "P4\n%d %d\n", EPD_WIDTH, EPD_HEIGHT);
+  fwrite(frame, 1, kFrameBytes, out);
+  fclose(out);
+}
+
+void ParseBusyTimes(const char* arg) {
+  if (sscanf(arg, "%lf,%lf,%lf", &timing.full_ms, &timing.fast_ms, &timing.partial_ms) != 3) {
+    Fail("-b expects <full>,<fast>,<partial>");
+  }
+}
+
+}  // namespace
+
+// Arduino and EpdIf, as the driver sees them.
+
+HostSerial Serial;
+ArduinoLowPowerClass LowPower;
+
+void HostSerial::print(const char* s) { if (verbose) fputs(s, stdout); }
+void HostSerial::print(char c) { if (verbose) fputc(c, stdout); }
+void HostSerial::print(long n, int base) { if (verbose) printf(base == HEX ? "%lx" : "%ld", n); }
+void HostSerial::print(unsigned long n, int base) { if (verbose) printf(base == HEX ? "%lx" : "%lu", n); }
+void HostSerial::print(double n) { if (verbose) printf("%.2f", n); }
+
+unsigned long millis() { return (unsigned long)(now_us / 1000); }
+unsigned long micros() { return (unsigned long)now_us; }
+void delay(unsigned long ms) { now_us += ms * 1000.0; }
+void delayMicroseconds(unsigned int us) { now_us += us; }
+void pinMode(int, int) {}
+void digitalWrite(int pin, int value) { controller.Pin(pin, value); }
+int digitalRead(int pin) { return pin == BUSY_PIN ? controller.Idle() : 0; }
+
+int readBatteryPercent() { return battery_percent; }
+
+unsigned long EpdIf::spi_bytes = 0;
+
+EpdIf::EpdIf() {}
+EpdIf::~EpdIf() {}
+int EpdIf::IfInit(void) { return 0; }
+void EpdIf::DigitalWrite(int pin, int value) { digitalWrite(pin, value); }
+int EpdIf::DigitalRead(int pin) { return digitalRead(pin); }
+void EpdIf::DelayMs(unsigned int delaytime) { delay(delaytime); }
+void EpdIf::SpiWait(void) {}
+unsigned long EpdIf::ClockTicks(void) { return millis(); }
+void EpdIf::SleepMs(unsigned long ms) { delay(ms); }
+
+// Standby lasts until BUSY rises or the timeout, whichever comes first.
+void EpdIf::SleepUntilRise(int pin, unsigned long timeout_ms) {
+  double wake = now_us + timeout_ms * 1000.0;
+  if (pin == BUSY_PIN && controller.busy_until() < wake) {
+    wake = controller.busy_until();
+  }
+  if (wake > now_us) {
+    now_us = wake;
+  }
+}
+
+void EpdIf::SpiTransfer(unsigned char data) {
+  controller.Pin(CS_PIN, LOW);
+  bool poll = controller.Byte(data);
+  controller.Pin(CS_PIN, HIGH);
+  spi_bytes++;
+  SpiTime(1, 1, poll);
+}
+
+unsigned char EpdIf::SpiReceive(void) {
+  SpiTime(1, 1);
+  return controller.Read();
+}
+
+void EpdIf::SpiTransferBlock(const unsigned char* data, unsigned long len) {
+  controller.Pin(CS_PIN, LOW);
+  for (unsigned long i = 0; i < len; i++) {
+    controller.Byte(data[i]);
+  }
+  controller.Pin(CS_PIN, HIGH);
+  spi_bytes += len;
+  SpiTime(len, 1);
+}
+
+void EpdIf::SpiTransferRepeat(unsigned char value, unsigned long count) {
+  controller.Pin(CS_PIN, LOW);
+  for (unsigned long i = 0; i < count; i++) {
+    controller.Byte(value);
+  }
+  controller.Pin(CS_PIN, HIGH);
+  spi_bytes += count;
+  SpiTime(count, 1);
+}
+
+int main(int argc, char** argv) {
+  std::string prefix;
+  bool always_full = false;
+  int opt;
+  while ((opt = getopt(argc, argv, "o:ft:c:g:b:v")) != -1) {
+    switch (opt) {
+    case 'o': prefix = optarg; break;
+    case 'f': always_full = true; break;
+    case 't': temperature = atoi(optarg); break;
+    case 'c': timing.spi_hz = atof(optarg); break;
+    case 'g': timing.call_overhead_us = atof(optarg); break;
+    case 'b': ParseBusyTimes(optarg); break;
+    case 'v': verbose = true; break;
+    default:
+      fprintf(stderr, "usage: epdsim [-o prefix] [-f] [-t celsius] [-c hz] [-g us] [-b full,fast,partial] [-v] <frame>...\n");
+      return 2;
+    }
+  }
+  if (optind == argc) {
+    Fail("no frames given");
+  }
+
+  Epd epd;
+  printf("frame\trefresh\tbytes\tspi_ms\tpolls\tbusy_ms\ttotal_ms\n");
+  for (int n = 0; optind + n < argc; n++) {
+    Frame frame = ReadFrame(argv[optind + n]);
+    battery_percent = frame.battery;
+    RenderBusDescs(frame.descs.data(), frame.descs.size(), frame.status);
+
+    stats = Stats();
+    double start_us = now_us;
+    int x = 0, y = 0, w = 0, h = 0;
+    RenderDirtyWindow(&x, &y, &w, &h);
+    if (always_full) {
+      forceFullRefresh();
+    }
+    std::string kind;
+    switch (showRender(&epd)) {
+    case kRefreshSkipped: kind = "skipped"; break;
+    case kRefreshFull: kind = "full"; break;
+    case kRefreshFast: kind = "fast"; break;
+    case kRefreshWindow: kind = std::to_string(w) + "x" + std::to_string(h); break;
+    default: kind = "failed"; break;
+    }
+
+    printf("%d\t%s\t%lu\t%.1f\t%lu\t%.1f\t%.1f\n", n + 1, kind.c_str(), stats.bytes, stats.spi_us / 1000,
+           stats.polls, stats.busy_us / 1000, (now_us - start_us) / 1000);
+    if (!prefix.empty()) {
+      WritePbm(prefix + std::to_string(n + 1) + ".pbm", controller.panel());
+    }
+  }
+  return 0;
+}
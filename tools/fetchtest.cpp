@@ -0,0 +1,410 @@
+// fetchtest: runs the sketch's stop queries against a fake SL server on the
+// host, delivering the pipelined responses in pieces of various sizes with a
+// read that finds nothing between pieces, and checks every stop gets all its
+// departures back. Pieces that split responses across the HTTP ring buffer's
+// boundaries are the interesting ones. Each is run again with the first
+// stop's first answer a 503, so its retry is still to be sent when the last
+// stop's parser finishes early; that must not cost a second handshake.
+//
+// Then the retry policy: which failures are asked again, how long the
+// backoff takes, how many connects a server that hangs up on every request
+// costs, and how many wakes in a row of failed cycles leave the radio off.
+//
+//   fetchtest [-v]
+//
+// Prints one line per case and exits non-zero if any failed. -v passes the
+// sketch's Serial output through.
+
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+
+#include <Arduino.h>
+#include <WiFiNINA.h>
+
+#include "../bus_description.h"
+#include "../departure_parser.h"
+#include "../http_connection.h"
+#include "../retry_policy.h"
+#include "../stops.h"
+
+// Not in network.h, as the sketch only needs queryWebService().
+void queryStops(BusResults* results, long* now);
+
+namespace {
+
+bool verbose = false;
+unsigned long now_ms = 0;
+
+// Departures each stop's response lists; more than kMaxStopDepartures tests
+// the parser finishing before its body does.
+const int kDepartures[] = {5, 9, 14};
+const int kFirstDepartureMins = 20;
+
+// The fake server's state for the case being run.
+struct Server {
+  bool chunked;
+  size_t piece;
+  // The first fail_times requests for fail_stop are answered with
+  // fail_status.
+  int fail_stop;
+  int fail_status;
+  int fail_times;
+  // Close the connection on every request instead of answering it.
+  bool hang_up;
+  int requests[kStops];
+  std::string request;
+  std::string out;
+  size_t piece_left;
+  bool stalled;
+  bool open;
+  int connects;
+} server;
+
+std::string Clock(long secs) {
+  char text[32];
+  snprintf(text, sizeof(text), "2022-03-01T%02ld:%02ld:%02ld", secs / 3600 % 24, secs / 60 % 60, secs % 60);
+  return text;
+}
+
+int StopIndex(int stop_id) {
+  for (int stop = 0; stop < kStops; stop++) {
+    if (kStopTable[stop].id == stop_id) {
+      return stop;
+    }
+  }
+  return -1;
+}
+
+// Journey number of a stop's nth departure, so the checks can tell which
+// ones came back.
+int Journey(int stop, int n) {
+  return (stop + 1) * 1000 + n;
+}
+
+const long kLatestUpdate = 7 * 3600 + 30 * 60;
+
+std::string Body(int stop) {
+  std::string body = "{\"StatusCode\":0,\"Message\":null,\"ExecutionTime\":12,\"ResponseData\":{\"LatestUpdate\":\"" +
+                     Clock(kLatestUpdate) + "\",\"DataAge\":0,\"Metros\":[],\"Buses\":[";
+  for (int n = 0; n < kDepartures[stop]; n++) {
+    char bus[256];
+    snprintf(bus, sizeof(bus),
+             "%s{\"GroupOfLine\":null,\"TransportMode\":\"BUS\",\"LineNumber\":\"5%02d\",\"Destination\":\"Centrum\","
+             "\"JourneyDirection\":2,\"StopAreaName\":\"Torget\",\"StopAreaNumber\":%d,\"ExpectedDateTime\":\"%s\","
+             "\"JourneyNumber\":%d}",
+             n ? "," : "", stop, kStopTable[stop].id,
+             Clock(kLatestUpdate + (kFirstDepartureMins + 4 * n) * 60 + 30).c_str(), Journey(stop, n));
+    body += bus;
+  }
+  return body + "],\"Trains\":[],\"Trams\":[],\"Ships\":[]}}";
+}
+
+std::string Response(int stop) {
+  std::string body = Body(stop);
+  if (!server.chunked) {
+    return "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: " + std::to_string(body.size()) +
+           "\r\n\r\n" + body;
+  }
+  std::string response = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nTransfer-Encoding: chunked\r\n\r\n";
+  for (size_t at = 0; at < body.size(); at += 100) {
+    std::string chunk = body.substr(at, 100);
+    char size[16];
+    snprintf(size, sizeof(size), "%zx\r\n", chunk.size());
+    response += size + chunk + "\r\n";
+  }
+  return response + "0\r\n\r\n";
+}
+
+// Answers every complete request written so far, in order.
+void Serve() {
+  size_t end;
+  while ((end = server.request.find("\r\n\r\n")) != std::string::npos) {
+    std::string request = server.request.substr(0, end);
+    server.request.erase(0, end + 4);
+    size_t site = request.find("siteid=");
+    int stop = site == std::string::npos ? -1 : StopIndex(atoi(request.c_str() + site + 7));
+    if (stop < 0) {
+      server.out += "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n";
+      continue;
+    }
+    server.requests[stop]++;
+    if (stop == server.fail_stop && server.fail_times > 0) {
+      server.fail_times--;
+      server.out += "HTTP/1.1 " + std::to_string(server.fail_status) + " Error\r\nContent-Length: 0\r\n\r\n";
+    } else {
+      server.out += Response(stop);
+    }
+  }
+}
+
+// Runs one cycle of stop queries against the server as set up, the way
+// queryWebService() does.
+void RunCycle(BusResults* results, long* now) {
+  retryCycleBegin();
+  queryStops(results, now);
+  for (int stop = 0; stop < kStops; stop++) {
+    retryStopDone(results[stop].result);
+  }
+  retryCycleEnd();
+}
+
+void StartServer(bool chunked, size_t piece) {
+  server = Server();
+  server.chunked = chunked;
+  server.piece = piece;
+  server.fail_stop = -1;
+}
+
+bool RunCase(bool chunked, size_t piece, bool flaky) {
+  StartServer(chunked, piece);
+  if (flaky) {
+    server.fail_stop = 0;
+    server.fail_status = 503;
+    server.fail_times = 1;
+  }
+
+  BusResults results[kStops];
+  long now = 0;
+  RunCycle(results, &now);
+
+  // now counts from 2000, so only its time of day is ours.
+  bool ok = now % 86400 == kLatestUpdate;
+  std::string problems;
+  for (int stop = 0; stop < kStops; stop++) {
+    int expected = kDepartures[stop] < kMaxStopDepartures ? kDepartures[stop] : kMaxStopDepartures;
+    char text[64];
+    if (results[stop].result != 0) {
+      snprintf(text, sizeof(text), " stop %d result %d", stop, results[stop].result);
+      problems += text;
+      ok = false;
+      continue;
+    }
+    bool same = results[stop].len == expected;
+    for (int n = 0; same && n < expected; n++) {
+      same = results[stop].descs[n].journey_number == Journey(stop, n) &&
+             results[stop].descs[n].expected - now == (kFirstDepartureMins + 4 * n) * 60 + 30;
+    }
+    if (!same) {
+      snprintf(text, sizeof(text), " stop %d got %d of %d departures", stop, results[stop].len, expected);
+      problems += text;
+      ok = false;
+    }
+    free(results[stop].descs);
+  }
+  if (server.connects != 1) {
+    problems += " handshakes " + std::to_string(server.connects);
+    ok = false;
+  }
+  printf("%s\t%s\tpiece %zu%s%s\n", ok ? "ok" : "FAIL", chunked ? "chunked" : "length", piece,
+         flaky ? "\tretry" : "", problems.c_str());
+  return ok;
+}
+
+struct RetryCase {
+  const char* name;
+  // How the first stop's requests are answered
+  int fail_status;
+  int fail_times;
+  bool hang_up;
+  // What should happen: the first stop's result and how many times it was
+  // asked for, -1 for any number, connects, and the time the cycle took.
+  int result;
+  int requests;
+  int connects;
+  unsigned long min_ms;
+  unsigned long max_ms;
+};
+
+const RetryCase kRetryCases[] = {
+  // One retry, after kRetryDelayMs
+  {"one 500", 500, 1, false, 0, 2, 1, 500, 1000},
+  // The whole budget, backing off 0.5 + 1 + 2 s
+  {"500 every time", 500, 1000, false, 500, 1 + kRetryBudget, 1, 3500, 4500},
+  // Permanent, so not asked again
+  {"401", 401, 1000, false, 401, 1, 1, 0, 500},
+  // Reconnects stop at the budget plus one per stop.
+  {"hangs up", 0, 0, true, kConnectionLost, -1, kRetryBudget + kStops + 1, 0, 1000},
+};
+
+bool RunRetryCase(const RetryCase& c) {
+  StartServer(false, 1000000);
+  server.fail_stop = 0;
+  server.fail_status = c.fail_status;
+  server.fail_times = c.fail_times;
+  server.hang_up = c.hang_up;
+
+  BusResults results[kStops];
+  long now = 0;
+  unsigned long start = now_ms;
+  RunCycle(results, &now);
+  unsigned long elapsed = now_ms - start;
+
+  std::string problems;
+  for (int stop = 0; stop < kStops; stop++) {
+    int expected = stop == 0 || c.hang_up ? c.result : 0;
+    if (results[stop].result != expected) {
+      problems += " stop " + std::to_string(stop) + " result " + std::to_string(results[stop].result);
+    }
+    if (results[stop].result == 0) {
+      free(results[stop].descs);
+    }
+  }
+  if (c.requests >= 0 && server.requests[0] != c.requests) {
+    problems += " asked " + std::to_string(server.requests[0]) + " times";
+  }
+  if (server.connects != c.connects) {
+    problems += " connects " + std::to_string(server.connects);
+  }
+  if (elapsed < c.min_ms || elapsed >= c.max_ms) {
+    problems += " took " + std::to_string(elapsed) + " ms";
+  }
+  printf("%s\tretry\t%s%s\n", problems.empty() ? "ok" : "FAIL", c.name, problems.c_str());
+  return problems.empty();
+}
+
+// Cycles that fetch nothing leave the radio off for 0, 1, 3 and then 6
+// wakes, and one that fetches anything clears the history.
+bool RunBackoff() {
+  // Clear the history the earlier cases left.
+  while (!retryCycleBegin()) {
+  }
+  retryStopDone(0);
+  retryCycleEnd();
+
+  const char kExpected[] = "FF-F---F------F------";
+  std::string wakes;
+  for (size_t wake = 0; wake < sizeof(kExpected) - 1; wake++) {
+    if (!retryCycleBegin()) {
+      wakes += '-';
+      continue;
+    }
+    wakes += 'F';
+    retryStopDone(kConnectionLost);
+    retryCycleEnd();
+  }
+  // Straight after a failed cycle there's a single retry.
+  unsigned long delay_ms;
+  bool retries_cut = retryCycleBegin() && retryAllowed(500, 1, &delay_ms) && !retryAllowed(500, 1, &delay_ms);
+  retryStopDone(0);
+  retryCycleEnd();
+  bool reset = retryCycleBegin();
+  for (int k = 0; k < kRetryBudget; k++) {
+    reset = reset && retryAllowed(500, 1, &delay_ms);
+  }
+  retryStopDone(0);
+  retryCycleEnd();
+
+  bool ok = wakes == kExpected && retries_cut && reset;
+  printf("%s\tbackoff\t%s%s%s\n", ok ? "ok" : "FAIL", wakes.c_str(), retries_cut ? "" : " retries not cut",
+         reset ? "" : " not reset");
+  return ok;
+}
+
+}  // namespace
+
+// The fake server's side of the socket. Pipelined responses are queued as
+// the requests arrive; reads hand them out a piece at a time, with one read
+// finding nothing between pieces.
+
+int WiFiSSLClient::connect(const char*, uint16_t) {
+  server.open = true;
+  server.connects++;
+  server.request.clear();
+  server.out.clear();
+  server.piece_left = 0;
+  return 1;
+}
+
+size_t WiFiSSLClient::write(const uint8_t* buf, size_t size) {
+  if (!server.open) {
+    return 0;
+  }
+  if (server.hang_up) {
+    server.open = false;
+    return size;
+  }
+  server.request.append((const char*)buf, size);
+  Serve();
+  return size;
+}
+
+int WiFiSSLClient::available() {
+  now_ms++;
+  if (server.piece_left == 0 && !server.out.empty()) {
+    if (!server.stalled) {
+      server.stalled = true;
+      return 0;
+    }
+    server.stalled = false;
+    server.piece_left = server.piece < server.out.size() ? server.piece : server.out.size();
+  }
+  return server.piece_left;
+}
+
+int WiFiSSLClient::read(uint8_t* buf, size_t size) {
+  size_t n = size < server.piece_left ? size : server.piece_left;
+  memcpy(buf, server.out.data(), n);
+  server.out.erase(0, n);
+  server.piece_left -= n;
+  return n;
+}
+
+void WiFiSSLClient::stop() {
+  server.open = false;
+  server.out.clear();
+  server.piece_left = 0;
+}
+
+uint8_t WiFiSSLClient::connected() {
+  return server.open || !server.out.empty();
+}
+
+WiFiClass WiFi;
+
+// Arduino, as the network code sees it.
+
+HostSerial Serial;
+
+void HostSerial::print(const char* s) { if (verbose) fputs(s, stdout); }
+void HostSerial::print(char c) { if (verbose) putchar(c); }
+void HostSerial::print(long n, int) { if (verbose) printf("%ld", n); }
+void HostSerial::print(unsigned long n, int) { if (verbose) printf("%lu", n); }
+void HostSerial::print(double n) { if (verbose) printf("%g", n); }
+
+unsigned long millis() { return now_ms; }
+unsigned long micros() { return now_ms * 1000; }
+void delay(unsigned long ms) { now_ms += ms; }
+void delayMicroseconds(unsigned int) {}
+void pinMode(int, int) {}
+void digitalWrite(int, int) {}
+int digitalRead(int) { return 0; }
+
+int main(int argc, char** argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "v")) != -1) {
+    switch (opt) {
+    case 'v': verbose = true; break;
+    default:
+      fprintf(stderr, "usage: fetchtest [-v]\n");
+      return 2;
+    }
+  }
+
+  // Around the 64 byte reads and the 128 byte ring, plus a byte at a time
+  // and everything at once.
+  const size_t pieces[] = {1, 7, 63, 64, 65, 90, 100, 127, 128, 129, 200, 1000000};
+  int failures = 0;
+  for (int flaky = 0; flaky < 2; flaky++) {
+    for (int chunked = 0; chunked < 2; chunked++) {
+      for (size_t piece : pieces) {
+        failures += !RunCase(chunked, piece, flaky);
+      }
+    }
+  }
+  for (const RetryCase& c : kRetryCases) {
+    failures += !RunRetryCase(c);
+  }
+  failures += !RunBackoff();
+  return failures ? 1 : 0;
+}
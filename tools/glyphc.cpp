@@ -0,0 +1,410 @@
+// glyphc: compiles the glyph manifest (glyphs/glyphs.txt) and its PBM/PGM
+// sources into imagedata.h.
+//
+//   glyphc <manifest> <output header>
+//
+// Each source is a full DIGIT_HEIGHT cell. Glyphs are trimmed to the rows and
+// byte columns holding ink, PackBits compressed, and concatenated into a single
+// PROGMEM atlas; glyphs with identical trimmed bitmaps share one atlas entry.
+// Metrics go in one flat table per field, indexed by glyph id.
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Bitmap {
+  int width = 0;
+  int height = 0;
+  std::vector<bool> ink;  // row major
+
+  bool at(int x, int y) const { return ink[y * width + x]; }
+};
+
+struct Glyph {
+  std::string name;
+  int advance = 0;
+  int byte_width = 0;
+  int top = 0;
+  int height = 0;
+  std::vector<unsigned char> packed;
+  size_t atlas_offset = 0;
+};
+
+struct Group {
+  std::string name;
+  std::vector<std::string> glyphs;
+};
+
+[[noreturn]] void Fail(const std::string& message) {
+  fprintf(stderr, "glyphc: %s\n", message.c_str());
+  exit(1);
+}
+
+// Reads the next whitespace-separated header token, skipping # comments.
+std::string NextToken(std::istream& in) {
+  std::string token;
+  int c;
+  while ((c = in.get()) != EOF) {
+    if (c == '#') {
+      while ((c = in.get()) != EOF && c != '\n') {
+      }
+      continue;
+    }
+    if (isspace(c)) {
+      if (!token.empty()) {
+        break;
+      }
+      continue;
+    }
+    token.push_back(static_cast<char>(c));
+  }
+  return token;
+}
+
+int NextInt(std::istream& in, const std::string& path) {
+  std::string token = NextToken(in);
+  if (token.empty() || !isdigit(static_cast<unsigned char>(token[0]))) {
+    Fail(path + ": bad header");
+  }
+  return atoi(token.c_str());
+}
+
+// Loads a P1/P4 bitmap or a P2/P5 greymap. In greymaps, pixels darker than
+// half of maxval are ink.
+Bitmap LoadNetpbm(const std::string& path) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    Fail("can't open " + path);
+  }
+  std::string magic = NextToken(in);
+  if (magic != "P1" && magic != "P2" && magic != "P4" && magic != "P5") {
+    Fail(path + ": not a PBM or PGM file");
+  }
+  Bitmap bitmap;
+  bitmap.width = NextInt(in, path);
+  bitmap.height = NextInt(in, path);
+  int maxval = (magic == "P2" || magic == "P5") ? NextInt(in, path) : 1;
+  if (bitmap.width <= 0 || bitmap.height <= 0 || maxval <= 0 || maxval > 65535) {
+    Fail(path + ": bad dimensions");
+  }
+  bitmap.ink.resize(bitmap.width * bitmap.height);
+
+  if (magic == "P4") {
+    int row_bytes = (bitmap.width + 7) / 8;
+    std::vector<char> row(row_bytes);
+    for (int y = 0; y < bitmap.height; y++) {
+      if (!in.read(row.data(), row_bytes)) {
+        Fail(path + ": truncated");
+      }
+      for (int x = 0; x < bitmap.width; x++) {
+        bitmap.ink[y * bitmap.width + x] = (row[x / 8] >> (7 - x % 8)) & 1;
+      }
+    }
+  } else if (magic == "P5") {
+    int sample_bytes = maxval > 255 ? 2 : 1;
+    for (size_t i = 0; i < bitmap.ink.size(); i++) {
+      int value = 0;
+      for (int b = 0; b < sample_bytes; b++) {
+        int c = in.get();
+        if (c == EOF) {
+          Fail(path + ": truncated");
+        }
+        value = (value << 8) | c;
+      }
+      bitmap.ink[i] = value * 2 < maxval;
+    }
+  } else {
+    // P1 samples may be packed without whitespace, P2 samples may not.
+    for (size_t i = 0; i < bitmap.ink.size(); i++) {
+      if (magic == "P1") {
+        int c;
+        while ((c = in.get()) != EOF && c != '0' && c != '1') {
+          if (c == '#') {
+            while ((c = in.get()) != EOF && c != '\n') {
+            }
+          }
+        }
+        if (c == EOF) {
+          Fail(path + ": truncated");
+        }
+        bitmap.ink[i] = c == '1';
+      } else {
+        std::string token = NextToken(in);
+        if (token.empty()) {
+          Fail(path + ": truncated");
+        }
+        bitmap.ink[i] = atoi(token.c_str()) * 2 < maxval;
+      }
+    }
+  }
+  return bitmap;
+}
+
+// PackBits: a control byte n < 128 is followed by n + 1 literal bytes, and
+// n > 128 repeats the following byte 257 - n times. Runs of three or more
+// equal bytes are repeated, everything else is sent literally.
+std::vector<unsigned char> PackBits(const std::vector<unsigned char>& data) {
+  std::vector<unsigned char> out;
+  std::vector<unsigned char> literal;
+  auto flush = [&]() {
+    if (!literal.empty()) {
+      out.push_back(static_cast<unsigned char>(literal.size() - 1));
+      out.insert(out.end(), literal.begin(), literal.end());
+      literal.clear();
+    }
+  };
+
+  size_t i = 0;
+  while (i < data.size()) {
+    size_t run = 1;
+    while (i + run < data.size() && data[i + run] == data[i] && run < 128) {
+      run++;
+    }
+    if (run >= 3) {
+      flush();
+      out.push_back(static_cast<unsigned char>(257 - run));
+      out.push_back(data[i]);
+      i += run;
+    } else {
+      literal.push_back(data[i++]);
+      if (literal.size() == 128) {
+        flush();
+      }
+    }
+  }
+  flush();
+  return out;
+}
+
+std::vector<unsigned char> UnpackBits(const std::vector<unsigned char>& packed) {
+  std::vector<unsigned char> out;
+  size_t i = 0;
+  while (i < packed.size()) {
+    int control = packed[i++];
+    if (control < 128) {
+      out.insert(out.end(), packed.begin() + i, packed.begin() + i + control + 1);
+      i += control + 1;
+    } else {
+      out.insert(out.end(), 257 - control, packed[i++]);
+    }
+  }
+  return out;
+}
+
+// Trims a cell bitmap to the rows and byte columns holding ink and packs it.
+void CompileGlyph(const Bitmap& bitmap, Glyph* glyph) {
+  int top = -1;
+  int bottom = 0;
+  int right = 0;
+  for (int y = 0; y < bitmap.height; y++) {
+    for (int x = 0; x < bitmap.width; x++) {
+      if (bitmap.at(x, y)) {
+        if (top < 0) {
+          top = y;
+        }
+        bottom = y + 1;
+        if (x + 1 > right) {
+          right = x + 1;
+        }
+      }
+    }
+  }
+  if (top < 0) {
+    glyph->top = glyph->height = glyph->byte_width = 0;
+    glyph->packed.clear();
+    return;
+  }
+
+  glyph->top = top;
+  glyph->height = bottom - top;
+  glyph->byte_width = (right + 7) / 8;
+  std::vector<unsigned char> rows;
+  for (int y = top; y < bottom; y++) {
+    for (int b = 0; b < glyph->byte_width; b++) {
+      unsigned char byte = 0;
+      for (int bit = 0; bit < 8; bit++) {
+        int x = b * 8 + bit;
+        if (x < bitmap.width && bitmap.at(x, y)) {
+          byte |= 0x80 >> bit;
+        }
+      }
+      rows.push_back(byte);
+    }
+  }
+  glyph->packed = PackBits(rows);
+  if (UnpackBits(glyph->packed) != rows) {
+    Fail(glyph->name + ": PackBits round trip failed");
+  }
+}
+
+std::string DirName(const std::string& path) {
+  size_t slash = path.find_last_of('/');
+  return slash == std::string::npos ? "." : path.substr(0, slash);
+}
+
+void WriteBytes(FILE* out, const std::vector<unsigned char>& bytes) {
+  for (size_t i = 0; i < bytes.size(); i++) {
+    fprintf(out, "0x%02x%s", bytes[i], i + 1 == bytes.size() ? "" : ",");
+    if (i % 16 == 15 || i + 1 == bytes.size()) {
+      fprintf(out, "\n");
+    }
+  }
+}
+
+void WriteTable(FILE* out, const char* type, const char* name, const std::vector<Glyph>& glyphs,
+                int (*field)(const Glyph&)) {
+  fprintf(out, "const %s %s[GLYPH_COUNT] PROGMEM = {\n", type, name);
+  for (size_t i = 0; i < glyphs.size(); i++) {
+    fprintf(out, "%s%d", i % 16 ? "," : (i ? ",\n" : ""), field(glyphs[i]));
+  }
+  fprintf(out, "\n};\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    fprintf(stderr, "usage: glyphc <manifest> <output header>\n");
+    return 2;
+  }
+  std::string manifest_path = argv[1];
+  std::ifstream manifest(manifest_path);
+  if (!manifest) {
+    Fail("can't open " + manifest_path);
+  }
+
+  int cell_height = 0;
+  std::vector<Glyph> glyphs;
+  std::vector<Group> groups;
+  std::map<std::string, size_t> ids;
+  std::string line;
+  for (int line_number = 1; std::getline(manifest, line); line_number++) {
+    std::istringstream words(line.substr(0, line.find('#')));
+    std::string keyword;
+    if (!(words >> keyword)) {
+      continue;
+    }
+    std::string where = manifest_path + ":" + std::to_string(line_number);
+    if (keyword == "height") {
+      if (!(words >> cell_height) || cell_height <= 0 || cell_height > 255) {
+        Fail(where + ": bad height");
+      }
+    } else if (keyword == "glyph") {
+      Glyph glyph;
+      std::string file;
+      if (!(words >> glyph.name >> glyph.advance >> file) || glyph.advance < 0 || glyph.advance > 255) {
+        Fail(where + ": expected glyph <NAME> <advance> <file>");
+      }
+      if (ids.count(glyph.name)) {
+        Fail(where + ": duplicate glyph " + glyph.name);
+      }
+      if (!cell_height) {
+        Fail(where + ": height must come before the first glyph");
+      }
+      Bitmap bitmap = LoadNetpbm(DirName(manifest_path) + "/" + file);
+      if (bitmap.height != cell_height) {
+        Fail(where + ": " + file + " is not " + std::to_string(cell_height) + " rows high");
+      }
+      CompileGlyph(bitmap, &glyph);
+      if (glyph.byte_width > 255) {
+        Fail(where + ": " + file + " is too wide");
+      }
+      ids[glyph.name] = glyphs.size();
+      glyphs.push_back(glyph);
+    } else if (keyword == "group") {
+      Group group;
+      if (!(words >> group.name)) {
+        Fail(where + ": expected group <NAME> <glyph>...");
+      }
+      std::string member;
+      while (words >> member) {
+        if (!ids.count(member)) {
+          Fail(where + ": unknown glyph " + member);
+        }
+        group.glyphs.push_back(member);
+      }
+      groups.push_back(group);
+    } else {
+      Fail(where + ": unknown keyword " + keyword);
+    }
+  }
+  if (glyphs.empty() || glyphs.size() > 255) {
+    Fail(manifest_path + ": need between 1 and 255 glyphs");
+  }
+
+  // Lay out the atlas, sharing data between glyphs with identical bitmaps.
+  std::vector<unsigned char> atlas;
+  std::map<std::vector<unsigned char>, size_t> offsets;
+  for (Glyph& glyph : glyphs) {
+    std::vector<unsigned char> key = glyph.packed;
+    key.push_back(static_cast<unsigned char>(glyph.byte_width));
+    key.push_back(static_cast<unsigned char>(glyph.height));
+    auto found = offsets.find(key);
+    if (found != offsets.end()) {
+      glyph.atlas_offset = found->second;
+      continue;
+    }
+    glyph.atlas_offset = atlas.size();
+    offsets[key] = atlas.size();
+    atlas.insert(atlas.end(), glyph.packed.begin(), glyph.packed.end());
+  }
+  if (atlas.size() > 65535) {
+    Fail("atlas is larger than 64KB");
+  }
+
+  FILE* out = fopen(argv[2], "w");
+  if (!out) {
+    Fail(std::string("can't write ") + argv[2]);
+  }
+  fprintf(out, "// Generated by tools/glyphc from glyphs/glyphs.txt, do not edit.\n");
+  fprintf(out, "//\n");
+  fprintf(out, "// Glyphs sit in a DIGIT_HEIGHT tall cell whose bottom edge is the line's\n");
+  fprintf(out, "// baseline y. Only the rows from GLYPH_TOP to GLYPH_TOP + GLYPH_HEIGHT that hold\n");
+  fprintf(out, "// ink are stored, each GLYPH_BYTE_WIDTH bytes wide. A glyph's rows are one\n");
+  fprintf(out, "// PackBits stream starting at GLYPH_ATLAS[GLYPH_OFFSET[id]]: a control byte\n");
+  fprintf(out, "// n < 128 is followed by n + 1 literal bytes, n > 128 repeats the next byte\n");
+  fprintf(out, "// 257 - n times.\n\n");
+  fprintf(out, "#ifndef imagedata_h\n");
+  fprintf(out, "#define imagedata_h\n\n");
+  fprintf(out, "#include <avr/pgmspace.h>\n\n");
+  fprintf(out, "typedef uint8_t Glyph;\n\n");
+  fprintf(out, "const int DIGIT_HEIGHT = %d;\n", cell_height);
+  fprintf(out, "const int GLYPH_COUNT = %zu;\n\n", glyphs.size());
+
+  for (size_t i = 0; i < glyphs.size(); i++) {
+    fprintf(out, "const Glyph %s = %zu;\n", glyphs[i].name.c_str(), i);
+  }
+  fprintf(out, "\n");
+  for (const Group& group : groups) {
+    fprintf(out, "const Glyph %s[] = {", group.name.c_str());
+    for (size_t i = 0; i < group.glyphs.size(); i++) {
+      fprintf(out, "%s%s", i ? ", " : "", group.glyphs[i].c_str());
+    }
+    fprintf(out, "};\n");
+  }
+  fprintf(out, "\n");
+
+  WriteTable(out, "uint8_t", "GLYPH_BYTE_WIDTH", glyphs, [](const Glyph& g) { return g.byte_width; });
+  WriteTable(out, "uint8_t", "GLYPH_ADVANCE", glyphs, [](const Glyph& g) { return g.advance; });
+  WriteTable(out, "uint8_t", "GLYPH_TOP", glyphs, [](const Glyph& g) { return g.top; });
+  WriteTable(out, "uint8_t", "GLYPH_HEIGHT", glyphs, [](const Glyph& g) { return g.height; });
+  WriteTable(out, "uint16_t", "GLYPH_OFFSET", glyphs, [](const Glyph& g) { return static_cast<int>(g.atlas_offset); });
+  fprintf(out, "\nconst unsigned char GLYPH_ATLAS[%zu] PROGMEM = {\n", atlas.size());
+  WriteBytes(out, atlas);
+  fprintf(out, "};\n\n");
+  fprintf(out, "#endif\n");
+
+  if (fclose(out) != 0) {
+    Fail(std::string("failed writing ") + argv[2]);
+  }
+  fprintf(stderr, "glyphc: %zu glyphs, %zu atlas bytes (%zu shared)\n", glyphs.size(), atlas.size(),
+          glyphs.size() - offsets.size());
+  return 0;
+}
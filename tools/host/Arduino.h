@@ -0,0 +1,74 @@
+// Just enough of the Arduino API to build the sketch's display code on a host,
+// for the tools in this directory. Time is simulated, so millis(), micros()
+// and delay() are defined by the tool that links against them, as is where
+// Serial output goes.
+#ifndef host_arduino_h
+#define host_arduino_h
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <avr/pgmspace.h>
+
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define CHANGE 2
+#define FALLING 3
+#define RISING 4
+#define DEC 10
+#define HEX 16
+
+#ifndef min
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#endif
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// Only what comparing firmware versions needs.
+class String {
+public:
+  String(const char* text = "") {
+    strncpy(text_, text, sizeof(text_) - 1);
+    text_[sizeof(text_) - 1] = '\0';
+  }
+  bool operator<(const char* other) const { return strcmp(text_, other) < 0; }
+
+private:
+  char text_[32];
+};
+
+class HostSerial {
+public:
+  explicit operator bool() const { return true; }
+  void begin(unsigned long) {}
+  void print(const char* s);
+  void print(char c);
+  void print(long n, int base = DEC);
+  void print(unsigned long n, int base = DEC);
+  void print(int n, int base = DEC) { print((long)n, base); }
+  void print(unsigned int n, int base = DEC) { print((unsigned long)n, base); }
+  void print(double n);
+  template <class T> void println(T value) { print(value); print('\n'); }
+  template <class T> void println(T value, int base) { print(value, base); print('\n'); }
+  void println() { print('\n'); }
+};
+
+extern HostSerial Serial;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int value);
+int digitalRead(int pin);
+
+#endif
@@ -0,0 +1,16 @@
+// Host stand-in for ArduinoLowPower: sleeping just lets simulated time pass.
+#ifndef host_arduino_low_power_h
+#define host_arduino_low_power_h
+
+#include <Arduino.h>
+
+class ArduinoLowPowerClass {
+public:
+  void idle(uint32_t ms = 0) { delay(ms); }
+  void sleep(uint32_t ms = 0) { delay(ms); }
+  void deepSleep(uint32_t ms = 0) { delay(ms); }
+};
+
+extern ArduinoLowPowerClass LowPower;
+
+#endif
@@ -0,0 +1,18 @@
+// Host stand-in for the Arduino Client interface the sketch's HTTP code uses.
+#ifndef host_client_h
+#define host_client_h
+
+#include <Arduino.h>
+
+class Client {
+public:
+  virtual ~Client() {}
+  virtual int connect(const char* host, uint16_t port) = 0;
+  virtual size_t write(const uint8_t* buf, size_t size) = 0;
+  virtual int available() = 0;
+  virtual int read(uint8_t* buf, size_t size) = 0;
+  virtual void stop() = 0;
+  virtual uint8_t connected() = 0;
+};
+
+#endif
@@ -0,0 +1,46 @@
+// Host stand-in for FlashStorage. The flash area is const in the sketch, so
+// writes go to a copy held here instead. If HOST_FLASH names a file, the copy
+// starts out as that file and every change is saved back to it, so a later
+// run sees what an earlier one left, as after a reset.
+#ifndef host_flash_storage_h
+#define host_flash_storage_h
+
+#include <Arduino.h>
+
+class FlashClass {
+public:
+  FlashClass(const void* flash_addr, uint32_t size)
+      : base_((const uint8_t*)flash_addr), copy_((uint8_t*)malloc(size)), size_(size), path_(getenv("HOST_FLASH")) {
+    memcpy(copy_, base_, size);
+    FILE* file = path_ ? fopen(path_, "rb") : NULL;
+    if (file) {
+      if (fread(copy_, 1, size, file) != size) {
+        memcpy(copy_, base_, size);
+      }
+      fclose(file);
+    }
+  }
+  void erase(const volatile void* flash_ptr, uint32_t size) { memset(at(flash_ptr), 0xff, size); save(); }
+  void write(const volatile void* flash_ptr, const void* data, uint32_t size) {
+    memcpy(at(flash_ptr), data, size);
+    save();
+  }
+  void read(const volatile void* flash_ptr, void* data, uint32_t size) { memcpy(data, at(flash_ptr), size); }
+
+private:
+  uint8_t* at(const volatile void* flash_ptr) { return copy_ + ((const uint8_t*)flash_ptr - base_); }
+  void save() {
+    FILE* file = path_ ? fopen(path_, "wb") : NULL;
+    if (file) {
+      fwrite(copy_, 1, size_, file);
+      fclose(file);
+    }
+  }
+
+  const uint8_t* base_;
+  uint8_t* copy_;
+  uint32_t size_;
+  const char* path_;
+};
+
+#endif
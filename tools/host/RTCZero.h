@@ -0,0 +1,13 @@
+// Host stand-in for RTCZero, counting whole seconds of simulated time.
+#ifndef host_rtczero_h
+#define host_rtczero_h
+
+#include <Arduino.h>
+
+class RTCZero {
+public:
+  void begin(bool = false) {}
+  uint32_t getEpoch() { return millis() / 1000; }
+};
+
+#endif
@@ -0,0 +1,56 @@
+// Host stand-in for WiFiNINA. The Wi-Fi module always joins straight away;
+// WiFiSSLClient is defined by the tool that links against it, so it can play
+// the server.
+#ifndef host_wifinina_h
+#define host_wifinina_h
+
+#include <Arduino.h>
+#include <Client.h>
+
+#define WIFI_FIRMWARE_LATEST_VERSION "1.5.0"
+
+enum {
+  WL_IDLE_STATUS = 0,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_DISCONNECTED = 6,
+  WL_NO_MODULE = 255,
+};
+
+class IPAddress {
+public:
+  IPAddress(uint32_t address = 0) : address_(address) {}
+  operator uint32_t() const { return address_; }
+
+private:
+  uint32_t address_;
+};
+
+class WiFiClass {
+public:
+  int status() { return WL_CONNECTED; }
+  String firmwareVersion() { return String(WIFI_FIRMWARE_LATEST_VERSION); }
+  int begin(const char*, const char*) { return WL_CONNECTED; }
+  void end() {}
+  void setTimeout(unsigned long) {}
+  void config(IPAddress, IPAddress, IPAddress, IPAddress) {}
+  IPAddress localIP() { return IPAddress(0x0a00002a); }
+  IPAddress dnsIP(int = 0) { return IPAddress(0x0a000001); }
+  IPAddress gatewayIP() { return IPAddress(0x0a000001); }
+  IPAddress subnetMask() { return IPAddress(0xffffff00); }
+  uint8_t* BSSID(uint8_t* bssid) { memset(bssid, 0, 6); return bssid; }
+};
+
+extern WiFiClass WiFi;
+
+class WiFiSSLClient : public Client {
+public:
+  int connect(const char* host, uint16_t port) override;
+  size_t write(const uint8_t* buf, size_t size) override;
+  int available() override;
+  int read(uint8_t* buf, size_t size) override;
+  void stop() override;
+  uint8_t connected() override;
+};
+
+#endif
@@ -0,0 +1,4 @@
+// Placeholder secrets for host builds of the network code.
+#define SECRET_SSID "host"
+#define SECRET_PASS "host"
+#define SECRET_SL_API_KEY "host"
@@ -0,0 +1,12 @@
+// Host stand-in for the AVR/SAMD pgmspace API: flash is ordinary memory here.
+#ifndef host_pgmspace_h
+#define host_pgmspace_h
+
+#include <stdint.h>
+
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_byte_near(p) (*(const uint8_t*)(p))
+#define pgm_read_word_near(p) (*(const uint16_t*)(p))
+
+#endif
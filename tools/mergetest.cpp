@@ -0,0 +1,196 @@
+// mergetest: checks the sketch's mergeDepartures() against the combine it
+// replaced, a nested-loop journey dedupe and a bubble sort, on random stop
+// lists. Both must give the same departures, soonest first; departures due
+// at the same second may come in either order.
+//
+//   mergetest [-n <lists>] [-s <seed>]
+//
+// The lists are each stop's departures in time order, as the cache keeps
+// them, drawn from a small pool of journeys so buses calling at several
+// stops are common, with most times on whole minutes so ties are too. One in ten
+// is merged with the time unknown. Prints the first few lists that merged
+// differently, then one summary line, and exits non-zero if there were any.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <unistd.h>
+
+#include <Arduino.h>
+
+#include "../bus_description.h"
+#include "../departure_merge.h"
+#include "../departure_parser.h"
+#include "../stops.h"
+
+namespace {
+
+// The combine departure_cache.cpp had before mergeDepartures(), as it was
+// apart from reading the lists passed in rather than the cache.
+int OldCombine(const BusDescription (*lists)[kMaxStopDepartures], const int* counts, long now,
+               BusDescription* combined_descs) {
+  int unique_result_count = 0;
+  for (int stop = 0; stop < kStops; stop++) {
+    for (int i = 0; i < counts[stop]; i++) {
+      BusDescription desc = lists[stop][i];
+      if (now == 0) {
+        desc.mins[0] = ' ';
+        desc.mins[1] = ' ';
+      } else {
+        int mins = (desc.expected - now) / 60;
+        if (mins < kStopTable[stop].minimum_mins) {
+          continue;
+        }
+        desc.mins[0] = ((mins / 10) % 10) + '0';
+        desc.mins[1] = (mins % 10) + '0';
+      }
+
+      bool already_included = false;
+      for (int j = 0; j < unique_result_count; j++) {
+        if (desc.journey_number == combined_descs[j].journey_number) {
+          if (desc.expected < combined_descs[j].expected) {
+            memcpy(combined_descs[j].time, desc.time, 5);
+            memcpy(combined_descs[j].mins, desc.mins, 2);
+            combined_descs[j].expected = desc.expected;
+            combined_descs[j].stop_id = desc.stop_id;
+          }
+          already_included = true;
+          break;
+        }
+      }
+      if (!already_included) {
+        combined_descs[unique_result_count++] = desc;
+      }
+    }
+  }
+
+  while (true) {
+    bool done = true;
+    for (int j = 0; j < unique_result_count - 1; j++) {
+      if (combined_descs[j + 1].expected < combined_descs[j].expected) {
+        BusDescription temp = combined_descs[j];
+        combined_descs[j] = combined_descs[j + 1];
+        combined_descs[j + 1] = temp;
+        done = false;
+      }
+    }
+    if (done) {
+      break;
+    }
+  }
+  return unique_result_count;
+}
+
+bool SameDeparture(const BusDescription& a, const BusDescription& b) {
+  return memcmp(a.number, b.number, sizeof(a.number)) == 0 && memcmp(a.time, b.time, sizeof(a.time)) == 0 &&
+         memcmp(a.mins, b.mins, sizeof(a.mins)) == 0 && a.expected == b.expected &&
+         a.journey_number == b.journey_number && a.stop_id == b.stop_id;
+}
+
+bool ByTimeThenJourney(const BusDescription& a, const BusDescription& b) {
+  return a.expected < b.expected || (a.expected == b.expected && a.journey_number < b.journey_number);
+}
+
+// Whether merged holds the same departures as expected in an order that only
+// differs among ones due at the same second. expected is sorted in place.
+bool SameUpToTies(BusDescription* merged, int merged_count, BusDescription* expected, int expected_count) {
+  if (merged_count != expected_count) {
+    return false;
+  }
+  for (int i = 1; i < merged_count; i++) {
+    if (merged[i].expected < merged[i - 1].expected) {
+      return false;
+    }
+  }
+  BusDescription sorted[kMaxMergedDepartures];
+  std::copy(merged, merged + merged_count, sorted);
+  std::stable_sort(sorted, sorted + merged_count, ByTimeThenJourney);
+  std::stable_sort(expected, expected + expected_count, ByTimeThenJourney);
+  for (int i = 0; i < merged_count; i++) {
+    if (!SameDeparture(sorted[i], expected[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void PrintList(const char* name, const BusDescription* descs, int count) {
+  printf("  %s:", name);
+  for (int i = 0; i < count; i++) {
+    printf(" %d@%ld/%d", descs[i].journey_number, descs[i].expected, descs[i].stop_id);
+  }
+  printf("\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  long lists_to_run = 200000;
+  unsigned seed = 1;
+  int opt;
+  while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+    switch (opt) {
+    case 'n': lists_to_run = atol(optarg); break;
+    case 's': seed = strtoul(optarg, nullptr, 10); break;
+    default:
+      fprintf(stderr, "usage: mergetest [-n <lists>] [-s <seed>]\n");
+      return 2;
+    }
+  }
+
+  std::mt19937 rng(seed);
+  const long kNow = 8 * 3600;
+  int failures = 0;
+  long departures = 0;
+  long dropped = 0;
+  for (long run = 0; run < lists_to_run; run++) {
+    long now = rng() % 10 == 0 ? 0 : kNow;
+    int journeys = 1 + rng() % (kMaxMergedDepartures + 4);
+
+    BusDescription lists[kStops][kMaxStopDepartures];
+    const BusDescription* list_ptrs[kStops];
+    int counts[kStops];
+    for (int stop = 0; stop < kStops; stop++) {
+      counts[stop] = rng() % (kMaxStopDepartures + 1);
+      for (int i = 0; i < counts[stop]; i++) {
+        BusDescription* desc = &lists[stop][i];
+        desc->journey_number = 1000 + rng() % journeys;
+        // A minute either side of now up to an hour ahead, so some are too
+        // soon to catch and some round to the stop's minimum exactly.
+        desc->expected = kNow + ((long)(rng() % 62) - 1) * 60 + (rng() % 4 == 0 ? rng() % 60 : 0);
+        desc->stop_id = kStopTable[stop].id;
+        snprintf(desc->number, sizeof(desc->number), "%02d", desc->journey_number % 100);
+        char time[8];
+        snprintf(time, sizeof(time), "%02ld:%02ld", desc->expected / 3600 % 24, desc->expected / 60 % 60);
+        memcpy(desc->time, time, sizeof(desc->time));
+        desc->mins[0] = desc->mins[1] = '?';
+      }
+      std::stable_sort(lists[stop], lists[stop] + counts[stop],
+                       [](const BusDescription& a, const BusDescription& b) { return a.expected < b.expected; });
+      list_ptrs[stop] = lists[stop];
+      departures += counts[stop];
+    }
+
+    BusDescription merged[kMaxMergedDepartures];
+    BusDescription expected[kMaxMergedDepartures];
+    int merged_count = mergeDepartures(list_ptrs, counts, now, merged);
+    int expected_count = OldCombine(lists, counts, now, expected);
+    int total = 0;
+    for (int stop = 0; stop < kStops; stop++) {
+      total += counts[stop];
+    }
+    dropped += total - expected_count;
+    if (!SameUpToTies(merged, merged_count, expected, expected_count)) {
+      if (failures++ < 5) {
+        printf("FAIL\tmerge\tlist %ld, now %ld\n", run, now);
+        PrintList("merged", merged, merged_count);
+        PrintList("old", expected, expected_count);
+      }
+    }
+  }
+  printf("%s\tmerge\t%ld lists, %ld departures, %ld dropped, %d differ\n", failures ? "FAIL" : "ok",
+         lists_to_run, departures, dropped, failures);
+  return failures ? 1 : 0;
+}
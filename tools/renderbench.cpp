@@ -0,0 +1,248 @@
+// renderbench: times the sketch's render pipeline on the host over a matrix of
+// synthetic departure lists, so changes to the hot path come with numbers.
+//
+//   renderbench [-m <min ms per measurement>]
+//
+// For every case it measures:
+//   layout_ns     RenderBusDescs() building and indexing the display list
+//   frame_ns      RenderRows() over the whole frame, a band at a time
+//   span_ns       the same, skipping bands RowSpan() reports blank, as
+//                 Epd::SendRows() does
+//   bytes_ns      printElements() a byte at a time, as Epd::DisplayBytes() does
+// plus frame_ns per row and per byte, and instructions per frame_ns frame
+// when Linux perf counters are available ("-" otherwise). Output is one
+// tab-separated line per case under a header line. Times are the fastest of
+// several batches, which is the least noisy on a shared machine.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include <Arduino.h>
+
+#include "../bus_description.h"
+#include "../epd7in5_V2.h"
+#include "../render.h"
+
+namespace {
+
+const int kRowBytes = EPD_WIDTH / 8;
+const int kBatches = 5;
+
+double min_ms = 50;
+// Everything rendered is folded in here so the compiler can't drop the work.
+volatile unsigned sink;
+
+struct Case {
+  std::string name;
+  int lines;
+  int stop_id;
+  int status;
+};
+
+std::vector<BusDescription> MakeDescs(const Case& c) {
+  std::vector<BusDescription> descs(c.lines);
+  for (int i = 0; i < c.lines; i++) {
+    BusDescription& d = descs[i];
+    char text[16];
+    snprintf(text, sizeof(text), "%03d", 560 + i * 7);
+    memcpy(d.number, text, 3);
+    snprintf(text, sizeof(text), "%02d:%02d", 7 + i / 4, (i * 13) % 60);
+    memcpy(d.time, text, 5);
+    snprintf(text, sizeof(text), "%02d", (3 + i * 11) % 100);
+    memcpy(d.mins, text, 2);
+    d.journey_number = i;
+    d.stop_id = c.stop_id;
+  }
+  return descs;
+}
+
+void RenderFrame() {
+  unsigned char band[kRowBytes * EPD_BAND_ROWS];
+  for (int y = 0; y < EPD_HEIGHT; y += EPD_BAND_ROWS) {
+    RenderRows(band, y, EPD_BAND_ROWS);
+    sink += band[y % (kRowBytes * EPD_BAND_ROWS)];
+  }
+}
+
+void RenderSpannedFrame() {
+  unsigned char band[kRowBytes * EPD_BAND_ROWS];
+  for (int y = 0; y < EPD_HEIGHT; y += EPD_BAND_ROWS) {
+    bool blank = true;
+    for (int r = 0; r < EPD_BAND_ROWS && blank; r++) {
+      int first, end;
+      blank = !RowSpan(y + r, &first, &end);
+    }
+    if (!blank) {
+      RenderRows(band, y, EPD_BAND_ROWS);
+      sink += band[y % (kRowBytes * EPD_BAND_ROWS)];
+    }
+  }
+}
+
+void RenderFrameBytes() {
+  unsigned acc = 0;
+  for (int y = 0; y < EPD_HEIGHT; y++) {
+    for (int x = 0; x < kRowBytes; x++) {
+      acc += printElements(x == kRowBytes - 1, x, y);
+    }
+  }
+  sink += acc;
+}
+
+// Instruction counter for this thread, or -1 where perf events aren't allowed.
+int OpenInstructionCounter() {
+#ifdef __linux__
+  perf_event_attr attr = {};
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+  return -1;
+#endif
+}
+
+long long CountInstructions(int fd, void (*work)()) {
+#ifdef __linux__
+  if (fd < 0) {
+    return -1;
+  }
+  ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+  ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+  work();
+  ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+  long long count;
+  if (read(fd, &count, sizeof(count)) != sizeof(count)) {
+    return -1;
+  }
+  return count;
+#else
+  (void)fd;
+  (void)work;
+  return -1;
+#endif
+}
+
+// Nanoseconds per call of work, the best of kBatches batches each lasting
+// about min_ms.
+double Time(void (*work)()) {
+  typedef std::chrono::steady_clock Clock;
+  long iterations = 1;
+  for (;;) {
+    Clock::time_point start = Clock::now();
+    for (long i = 0; i < iterations; i++) {
+      work();
+    }
+    double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    if (ms >= min_ms / 4) {
+      iterations = (long)(iterations * min_ms / ms) + 1;
+      break;
+    }
+    iterations *= 4;
+  }
+  double best = 0;
+  for (int b = 0; b < kBatches; b++) {
+    Clock::time_point start = Clock::now();
+    for (long i = 0; i < iterations; i++) {
+      work();
+    }
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / iterations;
+    if (b == 0 || ns < best) {
+      best = ns;
+    }
+  }
+  return best;
+}
+
+// RenderBusDescs() for the case being timed.
+const Case* layout_case;
+std::vector<BusDescription> layout_descs;
+
+void Layout() {
+  sink += RenderBusDescs(layout_descs.data(), layout_case->lines, layout_case->status);
+}
+
+}  // namespace
+
+// Arduino, as render.cpp sees it. Serial output is dropped.
+
+HostSerial Serial;
+
+void HostSerial::print(const char*) {}
+void HostSerial::print(char) {}
+void HostSerial::print(long, int) {}
+void HostSerial::print(unsigned long, int) {}
+void HostSerial::print(double) {}
+
+unsigned long millis() { return 0; }
+unsigned long micros() { return 0; }
+void delay(unsigned long) {}
+void delayMicroseconds(unsigned int) {}
+void pinMode(int, int) {}
+void digitalWrite(int, int) {}
+int digitalRead(int) { return 0; }
+
+int readBatteryPercent() { return 87; }
+
+int main(int argc, char** argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "m:")) != -1) {
+    switch (opt) {
+    case 'm': min_ms = atof(optarg); break;
+    default:
+      fprintf(stderr, "usage: renderbench [-m min_ms]\n");
+      return 2;
+    }
+  }
+
+  // Departure counts 0 to 7 against the shortest and longest stop names, then
+  // an error frame with only the status and battery lines.
+  std::vector<Case> cases;
+  const struct { const char* name; int id; } stops[] = {{"torget", 4010}, {"skolan", 4027}, {"stugan", 4028}};
+  for (const auto& stop : stops) {
+    for (int lines = 0; lines <= 7; lines++) {
+      if (lines == 0 && stop.id != 4010) {
+        continue;
+      }
+      cases.push_back({std::to_string(lines) + "x" + stop.name, lines, stop.id, 0});
+    }
+  }
+  cases.push_back({"status", 0, 4010, -1234});
+
+  int counter = OpenInstructionCounter();
+  printf("case\tlines\telements_dropped\tlayout_ns\tframe_ns\tspan_ns\tbytes_ns\trow_ns\tbyte_ns\tframe_instructions\n");
+  for (const Case& c : cases) {
+    layout_case = &c;
+    layout_descs = MakeDescs(c);
+    double layout_ns = Time(&Layout);
+    int dropped = RenderBusDescs(layout_descs.data(), c.lines, c.status);
+
+    double frame_ns = Time(&RenderFrame);
+    double span_ns = Time(&RenderSpannedFrame);
+    double bytes_ns = Time(&RenderFrameBytes);
+    long long instructions = CountInstructions(counter, &RenderFrame);
+
+    printf("%s\t%d\t%d\t%.0f\t%.0f\t%.0f\t%.0f\t%.1f\t%.2f\t", c.name.c_str(), c.lines, dropped, layout_ns,
+           frame_ns, span_ns, bytes_ns, frame_ns / EPD_HEIGHT, frame_ns / (EPD_HEIGHT * kRowBytes));
+    if (instructions < 0) {
+      printf("-\n");
+    } else {
+      printf("%lld\n", instructions);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,85 @@
+#include <Arduino.h>
+
+#include "wake_scheduler.h"
+#include "departure_cache.h"
+#include "stops.h"
+#include "wall_clock.h"
+#include "logging.h"
+
+// Lines the board has room for.
+const int kDisplayedDepartures = 7;
+
+static int minimumMins(int stop_id) {
+  const Stop* stop = findStop(stop_id);
+  return stop != nullptr ? stop->minimum_mins : 0;
+}
+
+static int hourOf(long time) {
+  return (time / 3600) % 24;
+}
+
+bool inQuietHours() {
+  if (!wallClockValid()) {
+    return false;
+  }
+  int hour = hourOf(wallClockNow());
+  if (kQuietStartHour <= kQuietEndHour) {
+    return hour >= kQuietStartHour && hour < kQuietEndHour;
+  }
+  return hour >= kQuietStartHour || hour < kQuietEndHour;
+}
+
+unsigned long nextWakeMillis() {
+  if (!wallClockValid()) {
+    return kRefreshPeriodSecs * 1000UL;
+  }
+  long now = wallClockNow();
+  BusResults results = cachedDepartures();
+  int count = results.result == 0 ? results.len : 0;
+  if (count > kDisplayedDepartures) {
+    count = kDisplayedDepartures;
+  }
+
+  long wake;
+  if (inQuietHours()) {
+    // Until the quiet hours end, then the first fetch of the day.
+    wake = now - now % 3600 + 3600;
+    while (hourOf(wake) != kQuietEndHour) {
+      wake += 3600;
+    }
+  } else if (count == 0 || results.descs[0].expected - now > kServiceGapSecs) {
+    wake = now + kServiceGapPeriodSecs;
+  } else {
+    wake = now + kServiceRefreshPeriodSecs;
+  }
+
+  // A departure leaves the board once it's less than its stop's minimum
+  // away, give or take the grace.
+  for (int i = 0; i < count; i++) {
+    long minimum = minimumMins(results.descs[i].stop_id) * 60L;
+    long grace = kLeaveGraceSecs < minimum / 2 ? kLeaveGraceSecs : minimum / 2;
+    long leaves = results.descs[i].expected - minimum + grace;
+    if (leaves < wake) {
+      wake = leaves;
+    }
+  }
+  // Line up with the soonest departure's minute count ticking over, so it
+  // shows exactly right for a while after we wake.
+  if (count > 0) {
+    long expected = results.descs[0].expected;
+    long ticks = (expected - wake + 59) / 60;
+    if (ticks > 0) {
+      wake = expected - ticks * 60;
+    }
+  }
+  free(results.descs);
+
+  // A second's grace so the count has definitely ticked.
+  wake += 1;
+  if (wake - now < kMinSleepSecs) {
+    wake = now + kMinSleepSecs;
+  }
+  DEBUG_PRINT("Next wake in seconds: ");
+  DEBUG_PRINTLN(wake - now);
+  return (wake - now) * 1000UL;
+}
@@ -0,0 +1,34 @@
+#ifndef wake_scheduler_h
+#define wake_scheduler_h
+
+// Sleep while the time isn't known, so the first fetch sets it soon.
+const long kRefreshPeriodSecs = 5 * 60;
+// Longest sleep while buses are running. Departures leaving the board wake us
+// sooner; in between only the minute counts change, so they may run up to
+// this far behind, and a cache gone stale waits this long to be fetched.
+const long kServiceRefreshPeriodSecs = 15 * 60;
+// When nothing leaves for this long, sleep for kServiceGapPeriodSecs instead.
+const long kServiceGapSecs = 30 * 60;
+const long kServiceGapPeriodSecs = 20 * 60;
+// Shortest sleep, so a departure right at a minute boundary can't spin us.
+const long kMinSleepSecs = 30;
+// How long a departure may stay on the board after it gets too close to
+// catch, so departures leaving close together are taken off in one wake.
+// Never more than half the stop's minimum, so it's always still to come.
+const long kLeaveGraceSecs = 2 * 60;
+// No fetching between these hours, local time. Wakes still happen to take
+// departures off the board as they go.
+const int kQuietStartHour = 1;
+const int kQuietEndHour = 5;
+
+// Whether wallClockNow() falls in the quiet hours.
+bool inQuietHours();
+
+// How long to sleep before the next refresh: until a departure on the board
+// gets too close to catch, soon enough that it goes well before the bus does,
+// or at most kServiceRefreshPeriodSecs. The wake lands just after the soonest
+// departure's minute count ticks over. Without a clock it's
+// kRefreshPeriodSecs.
+unsigned long nextWakeMillis();
+
+#endif
@@ -0,0 +1,56 @@
+#include <Arduino.h>
+#include <RTCZero.h>
+
+#include "wall_clock.h"
+
+static RTCZero rtc;
+static bool valid = false;
+// What to add to the RTC's epoch to get wallClockNow(). The RTC itself is
+// left alone, as ArduinoLowPower sets its wake alarms relative to it.
+static long offset;
+
+// Days from 2000-01-01 to the given date.
+static long daysSince2000(int year, int month, int day) {
+  // Count from March so the leap day is the last day of the year, and from
+  // 1600 so the leap year rules divide evenly.
+  year -= month <= 2;
+  long years = year - 1600;
+  int month_from_march = (month + 9) % 12;
+  long day_of_year = (153 * month_from_march + 2) / 5 + day - 1;
+  long days = years * 365 + years / 4 - years / 100 + years / 400 + day_of_year;
+  // 2000-03-01 is day 60 after 2000-01-01 and day 146097 after 1600-03-01.
+  return days - 146097 + 60;
+}
+
+static int digits(const char* text, int count) {
+  int value = 0;
+  for (int i = 0; i < count; i++) {
+    value = value * 10 + (text[i] - '0');
+  }
+  return value;
+}
+
+// datetime is formatted as 2022-03-01T01:23:45
+long datetimeSeconds(const char* datetime) {
+  long days = daysSince2000(digits(datetime, 4), digits(datetime + 5, 2), digits(datetime + 8, 2));
+  long seconds = digits(datetime + 11, 2) * 3600L + digits(datetime + 14, 2) * 60L + digits(datetime + 17, 2);
+  return days * 86400L + seconds;
+}
+
+void wallClockSet(long now) {
+  if (!valid) {
+    // Keep whatever time the RTC has, so ArduinoLowPower's alarms still line
+    // up.
+    rtc.begin(false);
+  }
+  offset = now - (long)rtc.getEpoch();
+  valid = true;
+}
+
+bool wallClockValid() {
+  return valid;
+}
+
+long wallClockNow() {
+  return (long)rtc.getEpoch() + offset;
+}
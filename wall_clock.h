@@ -0,0 +1,16 @@
+#ifndef wall_clock_h
+#define wall_clock_h
+
+// Seconds since 2000-01-01 for an API time like 2022-03-01T07:31:40.
+long datetimeSeconds(const char* datetime);
+
+// Sets the time now, in datetimeSeconds() terms. The RTC keeps counting
+// through deep sleep, so the time stays good between fetches.
+void wallClockSet(long now);
+
+// Whether wallClockSet() has been called since power on.
+bool wallClockValid();
+
+long wallClockNow();
+
+#endif
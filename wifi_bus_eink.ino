@@ -28,192 +28,16 @@
 #include <ArduinoLowPower.h>
 
 #include "epd7in5_V2.h"
-#include "imagedata.h"
 #include "network.h"
+#include "departure_cache.h"
+#include "wake_scheduler.h"
+#include "retry_policy.h"
 #include "bus_description.h"
 #include "battery_monitor.h"
+#include "render.h"
+#include "panel_refresh.h"
 #include "logging.h"
 
-struct RenderElement {
-  int x;
-  int y;
-
-  Element el;
-
-  RenderElement* next = nullptr;
-};
-
-RenderElement* render_elements = nullptr;
-
-unsigned char getElementByte(RenderElement* curr_re, int x, int y) {
-  int element_left_byte_offset = (y - curr_re->y + DIGIT_HEIGHT) * curr_re->el.byte_width + (x - curr_re->x)/8;
-  int element_right_byte_offset = (y - curr_re->y + DIGIT_HEIGHT) * curr_re->el.byte_width + (x + 8 - curr_re->x)/8;
-  //    x
-  //    v
-  //    --want--
-  //  |_left_||_right_|
-  //  So, want (left << (x%8)) | (right >> (8 - x%8))
-  char left_byte = (x >= curr_re->x) ? pgm_read_byte_near(curr_re->el.data + element_left_byte_offset) : 0;
-  char right_byte = (((x - curr_re->x)/8 + 1) < curr_re->el.byte_width) ? pgm_read_byte_near(curr_re->el.data + element_right_byte_offset) : 0;
-  
-  if (curr_re->el.data == SEP.data) {
-    if (((curr_re->y - y) == (DIGIT_HEIGHT/2)) && (x - curr_re->x > 5) && (x - curr_re->x - curr_re->el.advance < -5)) {
-      left_byte = 0xFF;
-      right_byte = 0xFF;
-    } else {
-      left_byte = 0;
-      right_byte = 0;
-    }
-  }
-  return ((left_byte << ((x - curr_re->x + 8)%8)) | (right_byte >> (8 - ((x - curr_re->x + 8)%8))));
-}
-
-unsigned char printElements(bool last_in_line, int x_byte, int y) {
-  int x = x_byte * 8;
-  RenderElement* curr_re = render_elements;
-  char intersected_elements = 0;
-  while (curr_re != nullptr) {
-    if (y >= (curr_re->y - DIGIT_HEIGHT) && y < curr_re->y && x + 7 >= curr_re->x && x < (curr_re->x + curr_re->el.byte_width*8)) {
-      // We're in this element!
-      intersected_elements = intersected_elements | getElementByte(curr_re, x, y);
-    }
-    curr_re = curr_re->next;
-  }
-  return intersected_elements;
-}
-
-void RenderLine(Element* els, int len, int x, int y) {
-  int curr_x = x;
-  for (int i = 0; i < len; i++) {
-    RenderElement* el = new RenderElement();
-    el->x = curr_x;
-    el->y = y;
-    el->el = {byte_width: els[i].byte_width, advance: els[i].advance, data : els[i].data};
-    el->next = nullptr;
-    curr_x += el->el.advance;
-    if (!render_elements) {
-      render_elements = el;
-    } else {
-      RenderElement* tail = render_elements;
-      while(tail->next) {
-        tail = tail->next;
-      }
-      tail->next = el;
-    }
-  }
-}
-
-void RenderCentredLine(Element* els, int len, int y) {
-  int width = 0;
-  for (int i = 0; i < len; i++) {
-    width += els[i].advance;
-  }
-
-  RenderLine(els, len, 400 - width/2, y);
-}
-
-void RenderRightAlignedLine(Element* els, int len, int y) {
-  int width = 0;
-  for (int i = 0; i < len; i++) {
-    width += els[i].advance;
-  }
-
-  RenderLine(els, len, 800 - 55 - width, y);
-}
-
-void ClearRenderElements() {
-  RenderElement* next;
-  while(render_elements) {
-    next = render_elements->next;
-    delete render_elements;
-    render_elements = next;
-  }
-}
-
-void RenderBusDescs(BusDescription* descs, int count, int status) {
-  ClearRenderElements();
-  DEBUG_PRINT("RenderBusDescs with count ");
-  DEBUG_PRINTLN(count);
-  if (count > 7) {
-    count = 7;
-  }
-  for (int i = 0; i < count; i++) {
-    Element line[30];
-    int el_idx = 0;
-    for (int j = 0; j < 3; j++) {
-      line[el_idx++] = DIGITS[descs[i].number[j] - '0'];
-    }
-    line[el_idx++] = SEP;
-
-    for (int j = 0; j < 2; j++) {
-      line[el_idx++] = DIGITS[descs[i].mins[j] - '0'];
-    }
-    line[el_idx++] = MINS;
-  //  line[el_idx++] = SEP;
-
-    for (int j = 0; j < 5; j++) {
-      if (descs[i].time[j] == ':') {
-        line[el_idx++] = COLON_LIGHT;
-      } else {
-        line[el_idx++] = DIGITS_LIGHT[descs[i].time[j] - '0'];
-      }
-    }
-    line[el_idx++] = SEP;
-
-    switch (descs[i].stop_id) {
-    case 4027:
-      line[el_idx++] = SKOLAN;
-      break;
-    case 4028:
-      line[el_idx++] = STUGAN;
-      break;
-    case 4010:
-      line[el_idx++] = TORGET;
-      break;
-    }
-
-    RenderCentredLine(line, el_idx, (i+1) * (DIGIT_HEIGHT+5) + 50);
-  }
-
-  int battery_percentage = readBatteryPercent();
-
-  const int bottom_line_y = 450;
-
-  if(status != 0) {
-    bool neg = status < 0;
-    status = status < 0 ? -1 * status : status;
-    int status_els = 0;
-    Element status_line[9];
-    status_line[status_els++] = STATUS;
-    if (neg) {
-      status_line[status_els++] = SEP;
-    }
-    if (status >= 1000) {
-      status_line[status_els++] = DIGITS_SMALL[(status / 1000) % 10];
-    }
-    if (status >= 100) {
-      status_line[status_els++] = DIGITS_SMALL[(status / 100) % 10];
-    }
-    if (status >= 10) {
-      status_line[status_els++] = DIGITS_SMALL[(status / 10) % 10];
-    }
-    status_line[status_els++] = DIGITS_SMALL[status % 10];
-    RenderCentredLine(status_line, status_els, bottom_line_y);
-  }
-  
-  if (battery_percentage >= 0) {
-    int batt_els = 0;
-    Element batt_line[9];
-    if (battery_percentage >= 100) {
-      batt_line[batt_els++] = DIGITS_SMALL[battery_percentage / 100];
-    }
-    batt_line[batt_els++] = DIGITS_SMALL[(battery_percentage / 10) % 10];
-    batt_line[batt_els++] = DIGITS_SMALL[battery_percentage % 10];
-    batt_line[batt_els++] = PERCENT;
-    RenderRightAlignedLine(batt_line, batt_els, bottom_line_y);
-  }
-}
-
 Epd epd;
 
 void setup() {
@@ -226,6 +50,7 @@ void setup() {
 
   Serial.println("Setup");
   batterySetup();
+  departureCacheLoad();
   if (!checkWifi()) {
     Serial.println("Failed checking wifi. Sleeping forever.");
     RenderBusDescs(nullptr, 0, -99);
@@ -233,22 +58,35 @@ void setup() {
   }
 }
 
-void refreshDisplay() {
-  connectWifi();
-  BusResults results = queryWebService();
-  endWifi();
+// Error from the last fetch, shown under the cached departures until one
+// works.
+int last_status = 0;
 
-  if (epd.Init() != 0) {
-      Serial.print("e-Paper init failed\r\n ");
-      return;
+void refreshDisplay() {
+  if (departureCacheUsable()) {
+    // The minutes can be counted down from what we fetched last time, so
+    // the radio stays off.
+    Serial.println("Showing cached departures");
+    last_status = 0;
+  } else if (inQuietHours()) {
+    Serial.println("Quiet hours, not fetching");
+  } else if (retryCycleBegin()) {
+    last_status = connectWifi();
+    if (last_status == 0) {
+      last_status = queryWebService();
+    }
+    endWifi();
+    retryCycleEnd();
   }
-  
+  // Otherwise the API has been failing, so the radio stays off this wake and
+  // we count down from whatever we have.
+
   DEBUG_PRINT("Result: ");
-  DEBUG_PRINTLN(results.result);
+  DEBUG_PRINTLN(last_status);
+  BusResults results = cachedDepartures();
   if (results.result != 0 ) {
     RenderBusDescs(nullptr, 0, results.result);
-    epd.DisplayBytes(&printElements);
-    epd.Sleep();
+    showRender(&epd);
     return;
   }
 
@@ -268,17 +106,14 @@ void refreshDisplay() {
     Serial.println(results.descs[i].stop_id);
   }
 
-  RenderBusDescs(results.descs, results.len, 0);
-
-  DEBUG_PRINTLN("Displaying prepared bytes");
-  epd.DisplayBytes(&printElements);
+  // After a failure, say how old the departures are.
+  char fetched_time[5];
+  bool stale = last_status != 0 && departureCacheFetchedTime(fetched_time);
+  RenderBusDescs(results.descs, results.len, last_status, stale ? fetched_time : nullptr);
+  free(results.descs);
 
-  DEBUG_PRINTLN("Sleeping display");
-  epd.Sleep();
-  
+  showRender(&epd);
   DEBUG_PRINTLN("refreshDisplay returning");
- 
-  free(results.descs);
 }
 
 void loop() {
@@ -289,11 +124,11 @@ void loop() {
   Serial.print("Done, sleeping. Took ");
   Serial.print(millis() - start_millis);
   Serial.println("ms");
-  // Sleep for 5min, staying away if we're not connected to a serial connection over USB for debugging/programming
-  const int kRefreshPeriodMillis = 5 * 60 * 1000;
+  // Sleep until the departures next need updating, staying away if we're not connected to a serial connection over USB for debugging/programming
+  unsigned long sleep_millis = nextWakeMillis();
   if (Serial) {
-    delay(kRefreshPeriodMillis);
+    delay(sleep_millis);
   } else {
-    LowPower.deepSleep(kRefreshPeriodMillis);
+    LowPower.deepSleep(sleep_millis);
   }
 }